@@ -163,6 +163,16 @@ size_t ZPhysicalMemoryBacking::uncommit(zoffset offset, size_t length) const {
   return length;
 }
 
+bool ZPhysicalMemoryBacking::is_populate_supported() const {
+  // Not supported
+  return false;
+}
+
+bool ZPhysicalMemoryBacking::populate(zaddress addr, size_t size) const {
+  ShouldNotReachHere();
+  return false;
+}
+
 void ZPhysicalMemoryBacking::map(zaddress_unsafe addr, size_t size, zoffset offset) const {
   const ZErrno err = mremap(_base + untype(offset), untype(addr), size);
   if (err) {
@@ -81,6 +81,11 @@
 #define FALLOC_FL_PUNCH_HOLE             0x02
 #endif
 
+// madvise(2) flags
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE              23
+#endif
+
 // Filesystem types, see statfs(2)
 #ifndef TMPFS_MAGIC
 #define TMPFS_MAGIC                      0x01021994
@@ -708,6 +713,37 @@ size_t ZPhysicalMemoryBacking::uncommit(zoffset offset, size_t length) const {
   return length;
 }
 
+bool ZPhysicalMemoryBacking::is_populate_supported() const {
+  // Lazily committed memory is backed by populating its mapping. This
+  // requires that madvise(2) reports a failure to back the memory, rather
+  // than raising a SIGBUS. Explicit large pages must be reserved, and NUMA
+  // interleaving must be set up, at fallocate time, so those fall back to
+  // the normal commit path.
+  return UseMadvPopulateWrite &&
+         is_tmpfs() &&
+         !ZLargePages::is_explicit() &&
+         !ZNUMA::is_enabled();
+}
+
+bool ZPhysicalMemoryBacking::populate(zaddress addr, size_t size) const {
+  void* const start = (void*)untype(addr);
+
+  // Maybe madvise the mapping to use transparent huge pages
+  if (os::Linux::should_madvise_shmem_thps()) {
+    os::Linux::madvise_transparent_huge_pages(start, size);
+  }
+
+  // Allocate the backing memory and populate the page tables in one go
+  if (madvise(start, size, MADV_POPULATE_WRITE) == -1) {
+    ZErrno err;
+    log_debug_p(gc)("Failed to populate memory (%s)", err.to_string());
+    return false;
+  }
+
+  // Success
+  return true;
+}
+
 void ZPhysicalMemoryBacking::map(zaddress_unsafe addr, size_t size, zoffset offset) const {
   const void* const res = mmap((void*)untype(addr), size, PROT_READ|PROT_WRITE, MAP_FIXED|MAP_SHARED, _fd, untype(offset));
   if (res == MAP_FAILED) {
@@ -237,6 +237,16 @@ size_t ZPhysicalMemoryBacking::uncommit(zoffset offset, size_t length) {
   return _impl->uncommit(offset, length);
 }
 
+bool ZPhysicalMemoryBacking::is_populate_supported() const {
+  // Not supported, memory must be committed before it can be mapped
+  return false;
+}
+
+bool ZPhysicalMemoryBacking::populate(zaddress addr, size_t size) const {
+  ShouldNotReachHere();
+  return false;
+}
+
 void ZPhysicalMemoryBacking::map(zaddress_unsafe addr, size_t size, zoffset offset) const {
   assert(is_aligned(untype(offset), ZGranuleSize), "Misaligned: " PTR_FORMAT, untype(offset));
   assert(is_aligned(untype(addr), ZGranuleSize), "Misaligned: " PTR_FORMAT, addr);
@@ -45,6 +45,9 @@ class ZPhysicalMemoryBacking {
   size_t commit(zoffset offset, size_t length);
   size_t uncommit(zoffset offset, size_t length);
 
+  bool is_populate_supported() const;
+  bool populate(zaddress addr, size_t size) const;
+
   void map(zaddress_unsafe addr, size_t size, zoffset offset) const;
   void unmap(zaddress_unsafe addr, size_t size) const;
 };
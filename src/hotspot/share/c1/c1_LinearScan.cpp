@@ -32,6 +32,8 @@
 #include "c1/c1_LinearScan.hpp"
 #include "c1/c1_ValueStack.hpp"
 #include "code/vmreg.inline.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "runtime/timerTrace.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -259,9 +261,133 @@ void LinearScan::assign_spill_slot(Interval* it) {
   }
 }
 
+// Compact the spill area after allocation: two stack slots whose users have
+// disjoint lifetimes are merged into one. The lifetime of a slot is
+// conservatively approximated by the union of [from, to] of all intervals that
+// are assigned to it or that have it as their canonical spill slot, so holes
+// and the exact positions of spill stores are ignored.
+void LinearScan::share_spill_slots() {
+  const int num_slots = max_spills();
+  if (num_slots <= 1) {
+    return;
+  }
+  const int base = LinearScan::nof_regs + frame_map()->argcount();
+
+  // compute lifetime and size of each slot that was handed out by allocate_spill_slot
+  GrowableArray<int>  slot_from(num_slots, num_slots, max_jint);
+  GrowableArray<int>  slot_to(num_slots, num_slots, -1);
+  GrowableArray<bool> slot_double(num_slots, num_slots, false);
+
+  const int num_intervals = interval_count();
+  for (int i = 0; i < num_intervals; i++) {
+    Interval* it = interval_at(i);
+    if (it == nullptr || it->first() == Range::end()) {
+      continue;
+    }
+    int slots[2] = { it->assigned_reg(), it->canonical_spill_slot() };
+    for (int j = 0; j < 2; j++) {
+      int idx = slots[j] - base;
+      if (slots[j] < base || (j == 1 && slots[1] == slots[0])) {
+        continue;
+      }
+      assert(idx < num_slots, "spill slot out of range");
+      slot_from.at_put(idx, MIN2(slot_from.at(idx), it->from()));
+      slot_to.at_put(idx, MAX2(slot_to.at(idx), it->to()));
+      if (type2spill_size[it->type()] == 2) {
+        slot_double.at_put(idx, true);
+      }
+    }
+  }
+
+  // sort the used slots by the start of their lifetime
+  GrowableArray<int> order(num_slots);
+  for (int idx = 0; idx < num_slots; idx++) {
+    if (slot_to.at(idx) >= 0) {
+      order.append(idx);
+    }
+  }
+  for (int i = 1; i < order.length(); i++) {
+    int idx = order.at(i);
+    int j = i - 1;
+    while (j >= 0 && slot_from.at(order.at(j)) > slot_from.at(idx)) {
+      order.at_put(j + 1, order.at(j));
+      j--;
+    }
+    order.at_put(j + 1, idx);
+  }
+
+  // lay out the spill area again, reusing a slot of the same size whose
+  // previous lifetime ended before the current one starts
+  const int old_unused_spill_slot = _unused_spill_slot;
+  _max_spills = 0;
+  _unused_spill_slot = -1;
+  GrowableArray<int>  new_slot(num_slots, num_slots, -1);
+  GrowableArray<int>  free_slot(num_slots);
+  GrowableArray<int>  free_to(num_slots);
+  GrowableArray<bool> free_double(num_slots);
+  for (int i = 0; i < order.length(); i++) {
+    int idx = order.at(i);
+    bool double_word = slot_double.at(idx);
+    int slot = -1;
+    for (int j = 0; j < free_slot.length(); j++) {
+      if (free_double.at(j) == double_word && free_to.at(j) < slot_from.at(idx)) {
+        slot = free_slot.at(j);
+        free_to.at_put(j, slot_to.at(idx));
+        break;
+      }
+    }
+    if (slot == -1) {
+      slot = allocate_spill_slot(double_word);
+      free_slot.append(slot);
+      free_to.append(slot_to.at(idx));
+      free_double.append(double_word);
+    }
+    new_slot.at_put(idx, slot);
+  }
+
+  // The new layout can have alignment holes that the old one did not have, so
+  // it is not necessarily smaller. Keep the old assignment if nothing is saved.
+  if (_max_spills >= num_slots) {
+    TRACE_LINEAR_SCAN(2, tty->print_cr("shared spill slots: %d -> %d, keeping old layout", num_slots, _max_spills));
+    _max_spills = num_slots;
+    _unused_spill_slot = old_unused_spill_slot;
+    return;
+  }
+
+  TRACE_LINEAR_SCAN(2, tty->print_cr("shared spill slots: %d -> %d", num_slots, _max_spills));
+
+  // rewrite all references to the old slots
+  for (int i = 0; i < num_intervals; i++) {
+    Interval* it = interval_at(i);
+    if (it == nullptr) {
+      continue;
+    }
+    if (it->assigned_reg() >= base) {
+      it->assign_reg(new_slot.at(it->assigned_reg() - base));
+    }
+    if (it->is_split_parent() && it->canonical_spill_slot() >= base) {
+      it->move_canonical_spill_slot(new_slot.at(it->canonical_spill_slot() - base));
+    }
+  }
+}
+
 void LinearScan::propagate_spill_slots() {
+  const int num_spills = max_spills();
+  if (C1ShareSpillSlots) {
+    share_spill_slots();
+  }
   if (!frame_map()->finalize_frame(max_spills())) {
     bailout("frame too large");
+    return;
+  }
+
+  LogTarget(Debug, jit, compilation) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("C1 spill slots %d -> %d, frame size %d bytes: ",
+             num_spills, max_spills(), in_bytes(frame_map()->framesize_in_bytes()));
+    compilation()->method()->print_short_name(&ls);
+    ls.cr();
   }
 }
 
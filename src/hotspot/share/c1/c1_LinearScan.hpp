@@ -222,6 +222,7 @@ class LinearScan : public CompilationResourceObj {
   // General helper functions
   int         allocate_spill_slot(bool double_word);
   void        assign_spill_slot(Interval* it);
+  void        share_spill_slots();
   void        propagate_spill_slots();
 
   Interval*   create_interval(int reg_num);
@@ -584,6 +585,7 @@ class Interval : public CompilationResourceObj {
   // information stored in split parent, but available for all children
   int              canonical_spill_slot() const            { return split_parent()->_canonical_spill_slot; }
   void             set_canonical_spill_slot(int slot)      { assert(split_parent()->_canonical_spill_slot == -1, "overwriting existing value"); split_parent()->_canonical_spill_slot = slot; }
+  void             move_canonical_spill_slot(int slot)     { assert(split_parent()->_canonical_spill_slot != -1, "no value to move"); split_parent()->_canonical_spill_slot = slot; }
   Interval*        current_split_child() const             { return split_parent()->_current_split_child; }
   void             make_current_split_child()              { split_parent()->_current_split_child = this; }
 
@@ -218,6 +218,10 @@
   develop(bool, CountLinearScan, false,                                     \
           "collect statistic counters during LinearScan")                   \
                                                                             \
+  product(bool, C1ShareSpillSlots, false, EXPERIMENTAL,                     \
+          "Let LinearScan reuse the stack slot of a spilled interval for "  \
+          "intervals whose lifetimes do not overlap with it")               \
+                                                                            \
   /* C1 variable */                                                         \
                                                                             \
   develop(bool, C1Breakpoint, false,                                        \
@@ -166,7 +166,7 @@ ArchiveBuilder::ArchiveBuilder() :
   _rw_src_objs(),
   _ro_src_objs(),
   _src_obj_table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE),
-  _buffered_to_src_table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE),
+  _buffered_to_src_table(INITIAL_TABLE_SIZE),
   _total_heap_region_size(0),
   _estimated_metaspaceobj_bytes(0),
   _estimated_hashtable_bytes(0)
@@ -685,10 +685,11 @@ void ArchiveBuilder::make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* s
 
   {
     bool created;
-    _buffered_to_src_table.put_if_absent((address)dest, src, &created);
+    bool grown;
+    _buffered_to_src_table.put_if_absent((address)dest, src, &created, &grown);
     assert(created, "must be");
-    if (_buffered_to_src_table.maybe_grow()) {
-      log_info(cds, hashtables)("Expanded _buffered_to_src_table table to %d", _buffered_to_src_table.table_size());
+    if (grown) {
+      log_info(cds, hashtables)("Expanded _buffered_to_src_table table to %u", _buffered_to_src_table.capacity());
     }
   }
 
@@ -66,6 +66,11 @@
   product(bool, AllowArchivingWithJavaAgent, false, DIAGNOSTIC,             \
           "Allow Java agent to be run with CDS dumping")                    \
                                                                             \
+  product(bool, ArchiveFieldReferences, false, DIAGNOSTIC,                  \
+          "Resolve getfield/putfield references at dump time and store "    \
+          "the results in the CDS archive, when they are guaranteed to "    \
+          "resolve to the same field at run time")                          \
+                                                                            \
   develop(ccstr, ArchiveHeapTestClass, nullptr,                             \
           "For JVM internal testing only. The static field named "          \
           "\"archivedObjects\" of the specified class is stored in the "    \
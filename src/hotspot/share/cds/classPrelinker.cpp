@@ -28,6 +28,8 @@
 #include "cds/classPrelinker.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
+#include "interpreter/bytecodeStream.hpp"
+#include "interpreter/interpreterRuntime.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/constantPool.inline.hpp"
 #include "oops/instanceKlass.hpp"
@@ -140,6 +142,73 @@ void ClassPrelinker::dumptime_resolve_constants(InstanceKlass* ik, TRAPS) {
       break;
     }
   }
+
+  if (ArchiveFieldReferences) {
+    preresolve_field_cp_entries(ik, CHECK);
+  }
+}
+
+bool ClassPrelinker::can_archive_resolved_field(ConstantPool* cp, int cp_index, InstanceKlass* field_holder) {
+  assert(!is_in_archivebuilder_buffer(cp), "sanity");
+  assert(cp->tag_at(cp_index).is_field(), "must be a field reference");
+
+  int klass_cp_index = cp->uncached_klass_ref_index_at(cp_index);
+  if (!cp->tag_at(klass_cp_index).is_klass() || !can_archive_resolved_klass(cp, klass_cp_index)) {
+    // The referenced class must be resolved to the same class at run time.
+    return false;
+  }
+
+  // The field is declared in the referenced class or one of its super types, which
+  // are archived together with it. Loader constraints for the field type are only
+  // checked when the declaring class is in a different loader, so don't archive
+  // those entries.
+  return field_holder->class_loader_data() == cp->pool_holder()->class_loader_data();
+}
+
+// Resolve the getfield/putfield bytecodes of ik's methods whose results can be
+// archived. Static field references are not resolved, as the interpreter only
+// caches them after the holder has been initialized.
+void ClassPrelinker::preresolve_field_cp_entries(InstanceKlass* ik, TRAPS) {
+  constantPoolHandle cp(THREAD, ik->constants());
+  Array<Method*>* methods = ik->methods();
+  for (int i = 0; i < methods->length(); i++) {
+    methodHandle m(THREAD, methods->at(i));
+    BytecodeStream bcs(m);
+    while (!bcs.is_last_bytecode()) {
+      bcs.next();
+      switch (bcs.raw_code()) {
+      case Bytecodes::_getfield:
+      case Bytecodes::_nofast_getfield:
+        maybe_resolve_field(cp, m, Bytecodes::_getfield, bcs.get_index_u2(), CHECK);
+        break;
+      case Bytecodes::_putfield:
+      case Bytecodes::_nofast_putfield:
+        maybe_resolve_field(cp, m, Bytecodes::_putfield, bcs.get_index_u2(), CHECK);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
+void ClassPrelinker::maybe_resolve_field(constantPoolHandle cp, const methodHandle& m,
+                                         Bytecodes::Code bc, int field_index, TRAPS) {
+  if (cp->resolved_field_entry_at(field_index)->is_resolved(bc)) {
+    return;
+  }
+  int cp_index = cp->to_cp_index(field_index, bc);
+  int klass_cp_index = cp->uncached_klass_ref_index_at(cp_index);
+  if (!cp->tag_at(klass_cp_index).is_klass() || !can_archive_resolved_klass(cp(), klass_cp_index)) {
+    // Resolving the field would load classes, or it can't be archived anyway.
+    return;
+  }
+
+  InterpreterRuntime::resolve_get_put(bc, field_index, m, cp, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    // The field reference will be resolved (and the error thrown) at run time.
+    CLEAR_PENDING_EXCEPTION;
+  }
 }
 
 Klass* ClassPrelinker::find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name) {
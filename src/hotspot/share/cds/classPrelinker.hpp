@@ -27,6 +27,7 @@
 
 #include "oops/oopsHierarchy.hpp"
 #include "memory/allStatic.hpp"
+#include "interpreter/bytecodes.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/handles.hpp"
 #include "utilities/exceptions.hpp"
@@ -67,6 +68,9 @@ class ClassPrelinker :  AllStatic {
   static Klass* maybe_resolve_class(constantPoolHandle cp, int cp_index, TRAPS);
   static bool can_archive_resolved_klass(InstanceKlass* cp_holder, Klass* resolved_klass);
   static Klass* find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name);
+  static void preresolve_field_cp_entries(InstanceKlass* ik, TRAPS);
+  static void maybe_resolve_field(constantPoolHandle cp, const methodHandle& m,
+                                  Bytecodes::Code bc, int field_index, TRAPS);
 
 public:
   static void initialize();
@@ -86,6 +90,10 @@ class ClassPrelinker :  AllStatic {
   // the result in the CDS archive? Returns true if cp_index is guaranteed to
   // resolve to the same InstanceKlass* at both dump time and run time.
   static bool can_archive_resolved_klass(ConstantPool* cp, int cp_index);
+
+  // Can the resolved getfield/putfield entry for the field reference at cp_index,
+  // whose field is declared in field_holder, be stored in the CDS archive?
+  static bool can_archive_resolved_field(ConstantPool* cp, int cp_index, InstanceKlass* field_holder);
 };
 
 #endif // SHARE_CDS_CLASSPRELINKER_HPP
@@ -76,7 +76,9 @@
 #include "runtime/reflection.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/dtrace.hpp"
+#include "utilities/latencyHistogram.hpp"
 #include "utilities/macros.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Runtime1.hpp"
@@ -133,6 +135,8 @@ ciEnv::ciEnv(CompileTask* task)
   assert(task == nullptr || thread->task() == task, "sanity");
   if (task != nullptr) {
     task->mark_started(os::elapsed_counter());
+    jlong queue_wait = task->time_started() - task->time_queued();
+    LatencyHistograms::compile_queue_wait.record((jlong)(TimeHelper::counter_to_seconds(queue_wait) * NANOSECS_PER_SEC));
   }
   _task = task;
   _log = nullptr;
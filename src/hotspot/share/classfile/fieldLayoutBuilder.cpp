@@ -606,11 +606,24 @@ void FieldLayoutBuilder::insert_contended_padding(LayoutRawBlock* slot) {
   }
 }
 
+// Returns true if the last inherited oop map block ends where the fields of
+// this class will start, so that oop fields allocated there extend it.
+bool FieldLayoutBuilder::super_ends_with_oops() const {
+  if (_super_klass == nullptr || _super_klass->nonstatic_oop_map_count() == 0) {
+    return false;
+  }
+  OopMapBlock* last = _super_klass->start_of_nonstatic_oop_maps() + _super_klass->nonstatic_oop_map_count() - 1;
+  return last->end_offset() == _layout->last_block()->offset();
+}
+
 // Computation of regular classes layout is an evolution of the previous default layout
 // (FieldAllocationStyle 1):
 //   - primitive fields are allocated first (from the biggest to the smallest)
 //   - then oop fields are allocated, either in existing gaps or at the end of
 //     the layout
+// With ContiguousOopFields, oop fields are allocated as a single contiguous
+// block, and before primitive fields if that block then directly follows the
+// oop fields of the super class, so the two share a single oop map block.
 void FieldLayoutBuilder::compute_regular_layout() {
   bool need_tail_padding = false;
   prologue();
@@ -623,8 +636,18 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
-  _layout->add(_root_group->primitive_fields());
-  _layout->add(_root_group->oop_fields());
+  if (ContiguousOopFields && !_is_contended && _root_group->oop_fields() != nullptr) {
+    if (super_ends_with_oops()) {
+      _layout->add_contiguously(_root_group->oop_fields(), _layout->last_block());
+      _layout->add(_root_group->primitive_fields());
+    } else {
+      _layout->add(_root_group->primitive_fields());
+      _layout->add_contiguously(_root_group->oop_fields(), _layout->last_block());
+    }
+  } else {
+    _layout->add(_root_group->primitive_fields());
+    _layout->add(_root_group->oop_fields());
+  }
 
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
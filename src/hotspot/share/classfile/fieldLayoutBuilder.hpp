@@ -259,6 +259,7 @@ class FieldLayoutBuilder : public ResourceObj {
   void prologue();
   void epilogue();
   void regular_field_sorting();
+  bool super_ends_with_oops() const;
   FieldGroup* get_or_create_contended_group(int g);
 };
 
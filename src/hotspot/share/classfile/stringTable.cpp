@@ -43,6 +43,7 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.hpp"
 #include "oops/oop.inline.hpp"
@@ -51,6 +52,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/timerTrace.hpp"
@@ -366,21 +368,88 @@ oop StringTable::intern(const char* utf8_string, TRAPS) {
   return result;
 }
 
+// A small direct-mapped cache of the strings a thread interned recently.
+// Entries are weak, so the cache does not keep strings alive. A string
+// that is still reachable through an entry is also still in the table.
+class StringTableInternCache : public CHeapObj<mtSymbol> {
+  static const uint size = 64;
+
+  struct Entry {
+    unsigned int _hash;
+    WeakHandle   _string;
+    Entry() : _hash(0), _string() {}
+  };
+  Entry _entries[size];
+
+public:
+  ~StringTableInternCache() {
+    for (uint i = 0; i < size; i++) {
+      if (!_entries[i]._string.is_empty()) {
+        _entries[i]._string.release(Universe::vm_weak());
+      }
+    }
+  }
+
+  oop lookup(unsigned int hash, const jchar* name, int len) const {
+    const Entry& e = _entries[hash % size];
+    if (e._string.is_empty() || e._hash != hash) {
+      return nullptr;
+    }
+    oop string = e._string.resolve();
+    if (string != nullptr && java_lang_String::equals(string, name, len)) {
+      return string;
+    }
+    return nullptr;
+  }
+
+  void insert(unsigned int hash, oop string) {
+    Entry& e = _entries[hash % size];
+    if (e._string.is_empty()) {
+      e._string = WeakHandle(Universe::vm_weak(), string);
+    } else {
+      e._string.replace(string);
+    }
+    e._hash = hash;
+  }
+};
+
+void StringTable::release_intern_cache(JavaThread* thread) {
+  StringTableInternCache* cache = thread->string_intern_cache();
+  if (cache != nullptr) {
+    thread->set_string_intern_cache(nullptr);
+    delete cache;
+  }
+}
+
 oop StringTable::intern(Handle string_or_null_h, const jchar* name, int len, TRAPS) {
   // shared table always uses java_lang_String::hash_code
   unsigned int hash = java_lang_String::hash_code(name, len);
-  oop found_string = lookup_shared(name, len, hash);
-  if (found_string != nullptr) {
-    return found_string;
+
+  StringTableInternCache* cache = nullptr;
+  if (UseStringInternCache) {
+    cache = THREAD->string_intern_cache();
+    if (cache == nullptr) {
+      cache = new StringTableInternCache();
+      THREAD->set_string_intern_cache(cache);
+    }
+    oop cached_string = cache->lookup(hash, name, len);
+    if (cached_string != nullptr) {
+      return cached_string;
+    }
   }
-  if (_alt_hash) {
-    hash = hash_string(name, len, true);
+
+  oop found_string = lookup_shared(name, len, hash);
+  if (found_string == nullptr) {
+    uintx table_hash = _alt_hash ? hash_string(name, len, true) : hash;
+    found_string = do_lookup(name, len, table_hash);
+    if (found_string == nullptr) {
+      found_string = do_intern(string_or_null_h, name, len, table_hash, CHECK_NULL);
+    }
   }
-  found_string = do_lookup(name, len, hash);
-  if (found_string != nullptr) {
-    return found_string;
+  if (cache != nullptr) {
+    cache->insert(hash, found_string);
   }
-  return do_intern(string_or_null_h, name, len, hash, THREAD);
+  return found_string;
 }
 
 oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
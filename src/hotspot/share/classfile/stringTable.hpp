@@ -77,6 +77,9 @@ class StringTable : AllStatic {
 
   static void create_table();
 
+  // Release the thread's cache of interned strings (UseStringInternCache).
+  static void release_intern_cache(JavaThread* thread);
+
   static void do_concurrent_work(JavaThread* jt);
   static bool has_work();
 
@@ -1231,9 +1231,20 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, KlassD
   // nmethod::check_all_dependencies works only correctly, if no safepoint
   // can happen
   NoSafepointVerifier nsv;
+  elapsedTimer timer;
+  timer.start();
+  int contexts = 0;
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     InstanceKlass* d = str.klass();
     d->mark_dependent_nmethods(deopt_scope, changes);
+    contexts++;
+  }
+  timer.stop();
+
+  if (log_is_enabled(Debug, dependencies)) {
+    ResourceMark rm;
+    log_debug(dependencies)("Checked dependents of %d contexts for loading %s in %.3f ms",
+                            contexts, changes.type()->external_name(), timer.seconds() * MILLIUNITS);
   }
 
 #ifndef PRODUCT
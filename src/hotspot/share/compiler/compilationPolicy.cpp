@@ -41,6 +41,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -621,9 +622,11 @@ void CompilationPolicy::handle_counter_overflow(const methodHandle& method) {
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = nullptr;
   CompileTask *max_task = nullptr;
+  CompileTask *overdue_task = nullptr;
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  jlong now = os::elapsed_counter();
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
@@ -656,6 +659,13 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
         max_blocking_task = task;
       }
+    } else if (TieredCompileTaskDeadline > 0 &&
+               TimeHelper::counter_to_millis(now - task->time_queued()) > TieredCompileTaskDeadline) {
+      // The method is still in use (otherwise it would have become stale),
+      // but hotter methods kept being selected ahead of it.
+      if (overdue_task == nullptr || task->time_queued() < overdue_task->time_queued()) {
+        overdue_task = task;
+      }
     }
 
     task = next_task;
@@ -669,6 +679,11 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
     // chance of such compilations timing out.
     max_task = max_blocking_task;
     max_method = max_task->method();
+  } else if (overdue_task != nullptr) {
+    // Serve tasks that missed their deadline in FIFO order, so that a steady
+    // stream of hot methods cannot starve them.
+    max_task = overdue_task;
+    max_method = max_task->method();
   }
 
   methodHandle max_method_h(Thread::current(), max_method);
@@ -336,6 +336,9 @@ void CompileQueue::add(CompileTask* task) {
   if (_size > _peak_size) {
     _peak_size = _size;
   }
+  if (_perf_size != nullptr) {
+    _perf_size->set_value(_size);
+  }
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -493,6 +496,16 @@ void CompileQueue::remove(CompileTask* task) {
   }
   --_size;
   ++_total_removed;
+  if (_perf_size != nullptr) {
+    _perf_size->set_value(_size);
+  }
+}
+
+void CompileQueue::init_perf_data(const char* perf_name, TRAPS) {
+  _perf_size = PerfDataManager::create_variable(SUN_CI, perf_name,
+                                                PerfData::U_Events,
+                                                (jlong)_size,
+                                                CHECK);
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -1006,6 +1019,12 @@ void CompileBroker::init_compiler_threads() {
 
   if (UsePerfData) {
     PerfDataManager::create_constant(SUN_CI, "threads", PerfData::U_Bytes, _c1_count + _c2_count, CHECK);
+    if (_c2_compile_queue != nullptr) {
+      _c2_compile_queue->init_perf_data("c2QueueSize", CHECK);
+    }
+    if (_c1_compile_queue != nullptr) {
+      _c1_compile_queue->init_perf_data("c1QueueSize", CHECK);
+    }
   }
 
 #if defined(ASSERT) && COMPILER2_OR_JVMCI
@@ -1024,6 +1043,8 @@ void CompileBroker::init_compiler_threads() {
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong free_memory = os::free_memory();
+  // The processor count may change at runtime, e.g. with container CPU quotas.
+  int max_threads = LimitThreadsToActiveProcessors ? os::active_processor_count() : INT_MAX;
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
@@ -1033,7 +1054,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c2_compile_queue != nullptr) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN4(MIN2(_c2_count, max_threads),
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
@@ -1094,7 +1115,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != nullptr) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN4(MIN2(_c1_count, max_threads),
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
@@ -2120,6 +2141,11 @@ void CompileBroker::handle_compile_error(CompilerThread* thread, CompileTask* ta
 
 static void post_compilation_event(EventCompilation& event, CompileTask* task) {
   assert(task != nullptr, "invariant");
+  // the start time is not recorded for all compilers
+  jlong queue_time = 0;
+  if (task->time_started() != 0) {
+    queue_time = (jlong)TimeHelper::counter_to_millis(task->time_started() - task->time_queued());
+  }
   CompilerEvent::CompilationEvent::post(event,
                                         task->compile_id(),
                                         task->compiler()->type(),
@@ -2129,7 +2155,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         task->nm_total_size(),
                                         task->num_inlined_bytecodes(),
-                                        task->arena_bytes());
+                                        task->arena_bytes(),
+                                        queue_time);
 }
 
 int DirectivesStack::_depth = 0;
@@ -92,6 +92,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   uint _total_added;
   uint _total_removed;
 
+  // Current queue length published as a jvmstat counter, or null.
+  PerfVariable* _perf_size;
+
   void purge_stale_tasks();
  public:
   CompileQueue(const char* name) {
@@ -103,6 +106,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _total_removed = 0;
     _peak_size = 0;
     _first_stale = nullptr;
+    _perf_size = nullptr;
   }
 
   const char*  name() const                      { return _name; }
@@ -122,6 +126,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
 
+  void         init_perf_data(const char* perf_name, TRAPS);
+
   // Redefine Classes support
   void mark_on_stack();
   void free_all();
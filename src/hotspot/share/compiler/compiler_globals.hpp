@@ -247,6 +247,12 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskDeadline, 0, EXPERIMENTAL,                 \
+          "Compile tasks that have been queued for longer than this many "  \
+          "milliseconds are selected ahead of hotter tasks, oldest first. " \
+          "0 means no deadline")                                            \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -336,9 +336,10 @@ void G1PLABAllocator::PLABData::notify_plab_refill(size_t tolerated_refills, siz
   }
 }
 
-G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
+G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator, uint worker_id) :
   _g1h(G1CollectedHeap::heap()),
-  _allocator(allocator) {
+  _allocator(allocator),
+  _worker_id(worker_id) {
 
   if (ResizePLAB) {
     // See G1EvacStats::compute_desired_plab_sz for the reasoning why this is the
@@ -358,7 +359,9 @@ G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
   // The initial PLAB refill should not count, hence the +1 for the first boost.
   size_t initial_tolerated_refills = ResizePLAB ? _tolerated_refills + 1 : _tolerated_refills;
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
-    _dest_data[state].initialize(alloc_buffers_length(state), _g1h->desired_plab_sz(state), initial_tolerated_refills);
+    size_t desired_plab_size = G1PerWorkerPLABSizing ? _g1h->desired_plab_sz(state, _worker_id)
+                                                     : _g1h->desired_plab_sz(state);
+    _dest_data[state].initialize(alloc_buffers_length(state), desired_plab_size, initial_tolerated_refills);
   }
 }
 
@@ -432,9 +435,39 @@ void G1PLABAllocator::undo_allocation(G1HeapRegionAttr dest, HeapWord* obj, size
   alloc_buffer(dest, node_index)->undo_allocation(obj, word_sz);
 }
 
+size_t G1PLABAllocator::plab_size_for_next_gc(region_type_t dest) const {
+  size_t allocated = 0;
+  size_t wasted = 0;
+  for (uint node_index = 0; node_index < alloc_buffers_length(dest); node_index++) {
+    PLAB* const buf = alloc_buffer(dest, node_index);
+    if (buf != nullptr) {
+      allocated += buf->allocated();
+      // The current buffer is not retired yet, its remaining space is
+      // filled with a dummy object when the stats are flushed.
+      wasted += buf->waste() + buf->words_remaining();
+    }
+  }
+  if (allocated == 0) {
+    // No information about this worker, use the common PLAB size.
+    return 0;
+  }
+
+  size_t plab_size = _dest_data[dest]._cur_desired_plab_size;
+  if (wasted * 100 > allocated * TargetPLABWastePct) {
+    // Start smaller to reduce waste.
+    return plab_size / 2;
+  }
+  // Start with the possibly boosted size to avoid refills.
+  return plab_size;
+}
+
 void G1PLABAllocator::flush_and_retire_stats(uint num_workers) {
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
     G1EvacStats* stats = _g1h->alloc_buffer_stats(state);
+    if (G1PerWorkerPLABSizing) {
+      // Must be done before flushing the PLABs resets their statistics.
+      stats->record_worker_plab_size(_worker_id, plab_size_for_next_gc(state));
+    }
     for (uint node_index = 0; node_index < alloc_buffers_length(state); node_index++) {
       PLAB* const buf = alloc_buffer(state, node_index);
       if (buf != nullptr) {
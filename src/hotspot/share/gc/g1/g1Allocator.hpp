@@ -149,6 +149,7 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
 
   G1CollectedHeap* _g1h;
   G1Allocator* _allocator;
+  uint _worker_id;
 
   // Collects per-destination information (e.g. young, old gen) about current PLAB
   // and statistics about it.
@@ -193,8 +194,11 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
+
+  // Returns the PLAB size this worker should start the next gc with for dest.
+  size_t plab_size_for_next_gc(region_type_t dest) const;
 public:
-  G1PLABAllocator(G1Allocator* allocator);
+  G1PLABAllocator(G1Allocator* allocator, uint worker_id);
 
   size_t waste() const;
   size_t undo_waste() const;
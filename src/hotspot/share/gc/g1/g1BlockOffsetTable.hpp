@@ -115,6 +115,10 @@ class G1BlockOffsetTable: public CHeapObj<mtGC> {
   // "addr".
   inline HeapWord* block_start_reaching_into_card(const void* addr) const;
 
+  // Prefetch the entry covering "addr" in anticipation of a later
+  // block_start_reaching_into_card() lookup.
+  inline void prefetch_entry_for(const void* addr) const;
+
   void update_for_block(HeapWord* blk_start, HeapWord* blk_end) {
     if (is_crossing_card_boundary(blk_start, blk_end)) {
       update_for_block_work(blk_start, blk_end);
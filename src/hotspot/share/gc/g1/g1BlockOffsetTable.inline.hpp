@@ -30,6 +30,7 @@
 #include "gc/shared/cardTable.hpp"
 #include "gc/shared/memset_with_concurrent_readers.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "oops/oop.inline.hpp"
 
 inline HeapWord* G1BlockOffsetTable::block_start_reaching_into_card(const void* addr) const {
@@ -49,6 +50,10 @@ inline HeapWord* G1BlockOffsetTable::block_start_reaching_into_card(const void*
   return q - offset;
 }
 
+inline void G1BlockOffsetTable::prefetch_entry_for(const void* addr) const {
+  Prefetch::read(entry_for_addr(addr), 0);
+}
+
 uint8_t G1BlockOffsetTable::offset_array(uint8_t* addr) const {
   check_address(addr, "Block offset table address out of range");
   return Atomic::load(addr);
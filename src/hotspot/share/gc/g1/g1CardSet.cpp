@@ -67,6 +67,7 @@ static uint default_log2_card_regions_per_region() {
 G1CardSetConfiguration::G1CardSetConfiguration() :
   G1CardSetConfiguration(HeapRegion::LogCardsPerRegion - default_log2_card_regions_per_region(),                                                                                   /* inline_ptr_bits_per_card */
                          G1RemSetArrayOfCardsEntries,                               /* max_cards_in_array */
+                         G1RemSetArrayOfCardsRunsThreshold,                         /* array_runs_threshold */
                          (double)G1RemSetCoarsenHowlBitmapToHowlFullPercent / 100,  /* cards_in_bitmap_threshold_percent */
                          G1RemSetHowlNumBuckets,                                    /* num_buckets_in_howl */
                          (double)G1RemSetCoarsenHowlToFullPercent / 100,            /* cards_in_howl_threshold_percent */
@@ -86,6 +87,7 @@ G1CardSetConfiguration::G1CardSetConfiguration(uint max_cards_in_array,
                                                uint log2_card_regions_per_region) :
   G1CardSetConfiguration(log2i_exact(max_cards_in_card_set),                   /* inline_ptr_bits_per_card */
                          max_cards_in_array,                                   /* max_cards_in_array */
+                         0,                                                    /* array_runs_threshold */
                          cards_in_bitmap_threshold_percent,                    /* cards_in_bitmap_threshold_percent */
                          G1CardSetHowl::num_buckets(max_cards_in_card_set,     /* num_buckets_in_howl */
                                                     max_cards_in_array,
@@ -97,6 +99,7 @@ G1CardSetConfiguration::G1CardSetConfiguration(uint max_cards_in_array,
 
 G1CardSetConfiguration::G1CardSetConfiguration(uint inline_ptr_bits_per_card,
                                                uint max_cards_in_array,
+                                               uint array_runs_threshold,
                                                double cards_in_bitmap_threshold_percent,
                                                uint num_buckets_in_howl,
                                                double cards_in_howl_threshold_percent,
@@ -104,6 +107,8 @@ G1CardSetConfiguration::G1CardSetConfiguration(uint inline_ptr_bits_per_card,
                                                uint log2_card_regions_per_heap_region) :
   _inline_ptr_bits_per_card(inline_ptr_bits_per_card),
   _max_cards_in_array(max_cards_in_array),
+  // A run needs two entries.
+  _array_runs_threshold(max_cards_in_array >= 2 ? array_runs_threshold : 0),
   _num_buckets_in_howl(num_buckets_in_howl),
   _max_cards_in_card_set(max_cards_in_card_set),
   _cards_in_howl_threshold(max_cards_in_card_set * cards_in_howl_threshold_percent),
@@ -161,12 +166,12 @@ void G1CardSetConfiguration::init_card_set_alloc_options() {
 void G1CardSetConfiguration::log_configuration() {
   log_debug_p(gc, remset)("Card Set container configuration: "
                           "InlinePtr #cards %u size %zu "
-                          "Array Of Cards #cards %u size %zu "
+                          "Array Of Cards #cards %u size %zu runs threshold %u "
                           "Howl #buckets %u coarsen threshold %u "
                           "Howl Bitmap #cards %u size %zu coarsen threshold %u "
                           "Card regions per heap region %u cards per card region %u",
                           max_cards_in_inline_ptr(), sizeof(void*),
-                          max_cards_in_array(), G1CardSetArray::size_in_bytes(max_cards_in_array()),
+                          max_cards_in_array(), G1CardSetArray::size_in_bytes(max_cards_in_array()), array_runs_threshold(),
                           num_buckets_in_howl(), cards_in_howl_threshold(),
                           max_cards_in_howl_bitmap(), G1CardSetBitMap::size_in_bytes(max_cards_in_howl_bitmap()), cards_in_howl_bitmap_threshold(),
                           (uint)1 << log2_card_regions_per_heap_region(),
@@ -599,6 +604,15 @@ G1CardSet::ContainerPtr G1CardSet::create_coarsened_array_of_cards(uint card_in_
   return new_container;
 }
 
+bool G1CardSet::should_coarsen_to_array_runs(ContainerPtr cur_container, uint card_in_region) {
+  uint const threshold = _config->array_runs_threshold();
+  if (threshold == 0) {
+    return false;
+  }
+  G1CardSetInlinePtr value(cur_container);
+  return value.num_adjacent_cards(card_in_region, _config->inline_ptr_bits_per_card()) >= threshold;
+}
+
 bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
                                   ContainerPtr cur_container,
                                   uint card_in_region,
@@ -616,8 +630,9 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
     }
     case ContainerInlinePtr: {
       uint const size = _config->max_cards_in_array();
+      bool const run_encoded = should_coarsen_to_array_runs(cur_container, card_in_region);
       uint8_t* data = allocate_mem_object(ContainerArrayOfCards);
-      new (data) G1CardSetArray(card_in_region, size);
+      new (data) G1CardSetArray(card_in_region, size, run_encoded);
       new_container = make_container_ptr(data, ContainerArrayOfCards);
       break;
     }
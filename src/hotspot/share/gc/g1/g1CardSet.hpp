@@ -49,6 +49,7 @@ class G1CardSetConfiguration {
   uint _inline_ptr_bits_per_card;
 
   uint _max_cards_in_array;
+  uint _array_runs_threshold;
   uint _num_buckets_in_howl;
   uint _max_cards_in_card_set;
   uint _cards_in_howl_threshold;
@@ -63,6 +64,7 @@ class G1CardSetConfiguration {
 
   G1CardSetConfiguration(uint inline_ptr_bits_per_card,
                          uint max_cards_in_array,
+                         uint array_runs_threshold,
                          double cards_in_bitmap_threshold_percent,
                          uint num_buckets_in_howl,
                          double cards_in_howl_threshold_percent,
@@ -95,6 +97,9 @@ class G1CardSetConfiguration {
   // Maximum number of cards in "Array of Cards" set; 0 to disable.
   // Always coarsen to next level if full, so no specific threshold.
   uint max_cards_in_array() const { return _max_cards_in_array; }
+  // Minimum number of adjacent card pairs in an inline pointer container to
+  // coarsen it into a run encoded "Array of Cards"; 0 to disable.
+  uint array_runs_threshold() const { return _array_runs_threshold; }
 
   // Bitmap within Howl card set container configuration
   uint max_cards_in_howl_bitmap() const { return _max_cards_in_howl_bitmap; }
@@ -213,7 +218,8 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // 0...00000 free               (Empty, should never happen on a top-level ContainerPtr)
   // 1...11111 full               All card indexes in the whole area this ContainerPtr covers are part of this container.
   // X...XXX00 inline-ptr-cards   A handful of card indexes covered by this ContainerPtr are encoded within the ContainerPtr.
-  // X...XXX01 array of cards     The container is a contiguous array of card indexes.
+  // X...XXX01 array of cards     The container is a contiguous array of card indexes, or of card index
+  //                              runs if it has been created from an inline-ptr with enough adjacent cards.
   // X...XXX10 bitmap             The container uses a bitmap to determine whether a given index is part of this set.
   // X...XXX11 howl               This is a card set container containing an array of ContainerPtr, with each ContainerPtr
   //                              limited to a sub-range of the original range. Currently only one level of this
@@ -294,6 +300,10 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
 
   ContainerPtr create_coarsened_array_of_cards(uint card_in_region, bool within_howl);
 
+  // Returns whether the inline ptr container cur_container, with card_in_region
+  // about to be added, should be coarsened into a run encoded array of cards.
+  bool should_coarsen_to_array_runs(ContainerPtr cur_container, uint card_in_region);
+
   // Transfer entries from source_card_set to a recently installed coarser storage type
   // We only need to transfer anything finer than ContainerBitMap. "Full" contains
   // all elements anyway.
@@ -104,6 +104,10 @@ class G1CardSetInlinePtr : public StackObj {
   template <class CardVisitor>
   void iterate(CardVisitor& found, uint const bits_per_card);
 
+  // Returns the number of pairs of consecutive card indexes in this container
+  // together with the given card_idx.
+  uint num_adjacent_cards(uint const card_idx, uint const bits_per_card);
+
   operator ContainerPtr () { return _value; }
 
   static uint max_cards_in_inline_ptr(uint bits_per_card) {
@@ -155,6 +159,13 @@ class G1CardSetContainer {
   static uint cards_per_region_limit() { return 1u << LogCardsPerRegionLimit; }
 };
 
+// Array of card indexes.
+//
+// The array may optionally be run encoded, decided at construction. Then every
+// two consecutive entries form an inclusive [start, end] range of cards. Runs
+// are only ever widened in place by a single entry store, or appended, so that
+// concurrent readers never miss a card that has been added before. Adjacent runs
+// are not merged.
 class G1CardSetArray : public G1CardSetContainer {
 public:
   typedef uint16_t EntryDataType;
@@ -167,6 +178,8 @@ class G1CardSetArray : public G1CardSetContainer {
 
   static const EntryCountType LockBitMask = (EntryCountType)1 << (sizeof(EntryCountType) * BitsPerByte - 1);
   static const EntryCountType EntryMask = LockBitMask - 1;
+  // Stored in _size.
+  static const EntryCountType RunEncodedBitMask = LockBitMask;
 
   class G1CardSetArrayLocker : public StackObj {
     EntryCountType volatile* _num_entries_addr;
@@ -184,8 +197,14 @@ class G1CardSetArray : public G1CardSetContainer {
       Atomic::release_store(_num_entries_addr, _local_num_entries);
     }
   };
+
+  EntryCountType size() const { return _size & ~RunEncodedBitMask; }
+
+  bool runs_contain(uint card_idx, EntryCountType num_entries);
+  G1AddCardResult add_to_runs(uint card_idx);
+
 public:
-  G1CardSetArray(uint const card_in_region, EntryCountType num_cards);
+  G1CardSetArray(uint const card_in_region, EntryCountType num_cards, bool run_encoded = false);
 
   G1AddCardResult add(uint card_idx);
 
@@ -194,6 +213,9 @@ class G1CardSetArray : public G1CardSetContainer {
   template <class CardVisitor>
   void iterate(CardVisitor& found);
 
+  bool is_run_encoded() const { return (_size & RunEncodedBitMask) != 0; }
+
+  // Number of used entries; two per run if run encoded.
   size_t num_entries() const { return _num_entries & EntryMask; }
 
   static size_t header_size_in_bytes();
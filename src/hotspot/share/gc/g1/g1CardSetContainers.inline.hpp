@@ -27,6 +27,7 @@
 
 #include "gc/g1/g1CardSetContainers.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
+#include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/checkedCast.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -117,6 +118,20 @@ inline void G1CardSetInlinePtr::iterate(CardVisitor& found, uint bits_per_card)
   }
 }
 
+inline uint G1CardSetInlinePtr::num_adjacent_cards(uint card_idx, uint bits_per_card) {
+  uint result = 0;
+  auto count_adjacent = [&] (uint card) {
+    if (card + 1 == card_idx || card == card_idx + 1) {
+      result++;
+    }
+    if (contains(card + 1, bits_per_card)) {
+      result++;
+    }
+  };
+  iterate(count_adjacent, bits_per_card);
+  return result;
+}
+
 inline bool G1CardSetContainer::try_increment_refcount() {
   uintptr_t old_value = refcount();
   while (true) {
@@ -139,13 +154,20 @@ inline uintptr_t G1CardSetContainer::decrement_refcount() {
   return Atomic::sub(&_ref_count, 2u);
 }
 
-inline G1CardSetArray::G1CardSetArray(uint card_in_region, EntryCountType num_cards) :
+inline G1CardSetArray::G1CardSetArray(uint card_in_region, EntryCountType num_cards, bool run_encoded) :
   G1CardSetContainer(),
   _size(num_cards),
   _num_entries(1) {
   assert(_size > 0, "CardSetArray of size 0 not supported.");
   assert(_size < LockBitMask, "Only support CardSetArray of size %u or smaller.", LockBitMask - 1);
   _data[0] = checked_cast<EntryDataType>(card_in_region);
+  if (run_encoded) {
+    assert(num_cards >= 2, "Run encoded CardSetArray needs at least two entries.");
+    // Every run takes two entries; an odd last entry is unused.
+    _size = align_down(num_cards, 2u) | RunEncodedBitMask;
+    _data[1] = _data[0];
+    _num_entries = 2;
+  }
 }
 
 inline G1CardSetArray::G1CardSetArrayLocker::G1CardSetArrayLocker(EntryCountType volatile* num_entries_addr) :
@@ -170,6 +192,9 @@ inline G1CardSetArray::G1CardSetArrayLocker::G1CardSetArrayLocker(EntryCountType
 inline G1AddCardResult G1CardSetArray::add(uint card_idx) {
   assert(card_idx < (1u << (sizeof(_data[0]) * BitsPerByte)),
          "Card index %u does not fit allowed card value range.", card_idx);
+  if (is_run_encoded()) {
+    return add_to_runs(card_idx);
+  }
   EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & EntryMask;
   EntryCountType idx = 0;
   for (; idx < num_entries; idx++) {
@@ -192,7 +217,7 @@ inline G1AddCardResult G1CardSetArray::add(uint card_idx) {
   }
 
   // Check if there is space left.
-  if (num_entries == _size) {
+  if (num_entries == size()) {
     return Overflow;
   }
 
@@ -203,9 +228,63 @@ inline G1AddCardResult G1CardSetArray::add(uint card_idx) {
   return Added;
 }
 
+inline bool G1CardSetArray::runs_contain(uint card_idx, EntryCountType num_entries) {
+  for (EntryCountType idx = 0; idx < num_entries; idx += 2) {
+    if (Atomic::load(&_data[idx]) <= card_idx && card_idx <= Atomic::load(&_data[idx + 1])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline G1AddCardResult G1CardSetArray::add_to_runs(uint card_idx) {
+  EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & EntryMask;
+  if (runs_contain(card_idx, num_entries)) {
+    return Found;
+  }
+
+  G1CardSetArrayLocker x(&_num_entries);
+
+  // Runs may have been widened while waiting for the lock, so look at all of
+  // them again.
+  num_entries = x.num_entries();
+  if (runs_contain(card_idx, num_entries)) {
+    return Found;
+  }
+
+  // A full array must not take any further cards, not even by widening a run,
+  // as it is about to be coarsened and its cards transferred.
+  if (num_entries == size()) {
+    return Overflow;
+  }
+
+  EntryDataType const card = checked_cast<EntryDataType>(card_idx);
+  for (EntryCountType idx = 0; idx < num_entries; idx += 2) {
+    if (_data[idx + 1] + 1u == card_idx) {
+      Atomic::store(&_data[idx + 1], card);
+      return Added;
+    } else if (_data[idx] == card_idx + 1) {
+      Atomic::store(&_data[idx], card);
+      return Added;
+    }
+  }
+
+  _data[num_entries] = card;
+  _data[num_entries + 1] = card;
+
+  x.inc_num_entries();
+  x.inc_num_entries();
+
+  return Added;
+}
+
 inline bool G1CardSetArray::contains(uint card_idx) {
   EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & EntryMask;
 
+  if (is_run_encoded()) {
+    return runs_contain(card_idx, num_entries);
+  }
+
   for (EntryCountType idx = 0; idx < num_entries; idx++) {
     if (_data[idx] == card_idx) {
       return true;
@@ -217,6 +296,15 @@ inline bool G1CardSetArray::contains(uint card_idx) {
 template <class CardVisitor>
 void G1CardSetArray::iterate(CardVisitor& found) {
   EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & EntryMask;
+  if (is_run_encoded()) {
+    for (EntryCountType idx = 0; idx < num_entries; idx += 2) {
+      uint const end = Atomic::load(&_data[idx + 1]);
+      for (uint card = Atomic::load(&_data[idx]); card <= end; card++) {
+        found(card);
+      }
+    }
+    return;
+  }
   for (EntryCountType idx = 0; idx < num_entries; idx++) {
     found(_data[idx]);
   }
@@ -581,6 +581,8 @@ class G1CollectedHeap : public CollectedHeap {
 
   // Determines PLAB size for a given destination.
   inline size_t desired_plab_sz(G1HeapRegionAttr dest);
+  // The PLAB size the given worker should start with for the given destination.
+  inline size_t desired_plab_sz(G1HeapRegionAttr dest, uint worker_id);
   // Clamp the given PLAB word size to allowed values. Prevents humongous PLAB sizes
   // for two reasons:
   // * PLABs are allocated using a similar paths as oops, but should
@@ -594,6 +596,8 @@ class G1CollectedHeap : public CollectedHeap {
 
   // Does the given region fulfill remembered set based eager reclaim candidate requirements?
   bool is_potential_eager_reclaim_candidate(HeapRegion* r) const;
+  // Returns whether the kind of the given humongous object supports eager reclaim.
+  static bool is_eager_reclaim_supported_type(oop obj);
 
   inline bool is_humongous_reclaim_candidate(uint region);
 
@@ -169,7 +169,8 @@ G1CollectionSetCandidates::G1CollectionSetCandidates() :
   _retained_regions(),
   _contains_map(nullptr),
   _max_regions(0),
-  _last_marking_candidates_length(0)
+  _last_marking_candidates_length(0),
+  _marking_sorted_by_efficiency(false)
 { }
 
 G1CollectionSetCandidates::~G1CollectionSetCandidates() {
@@ -195,15 +196,30 @@ void G1CollectionSetCandidates::clear() {
     _contains_map[i] = CandidateOrigin::Invalid;
   }
   _last_marking_candidates_length = 0;
+  _marking_sorted_by_efficiency = false;
 }
 
 void G1CollectionSetCandidates::sort_marking_by_efficiency() {
-  G1CollectionCandidateListIterator iter = _marking_regions.begin();
-  for (; iter != _marking_regions.end(); ++iter) {
-    HeapRegion* hr = (*iter)->_r;
-    (*iter)->_gc_efficiency = hr->calc_gc_efficiency();
+  if (_marking_sorted_by_efficiency) {
+    // Already done concurrently.
+    _marking_regions.verify();
+    return;
+  }
+  calc_marking_efficiency(0, _marking_regions.length());
+  sort_marking_by_calculated_efficiency();
+}
+
+void G1CollectionSetCandidates::calc_marking_efficiency(uint from, uint to) {
+  assert(to <= _marking_regions.length(), "out of bounds %u > %u", to, _marking_regions.length());
+  for (uint i = from; i < to; i++) {
+    G1CollectionSetCandidateInfo& ci = _marking_regions.at(i);
+    ci._gc_efficiency = ci._r->calc_gc_efficiency();
   }
+}
+
+void G1CollectionSetCandidates::sort_marking_by_calculated_efficiency() {
   _marking_regions.sort_by_efficiency();
+  _marking_sorted_by_efficiency = true;
 
   _marking_regions.verify();
 }
@@ -221,6 +237,7 @@ void G1CollectionSetCandidates::set_candidates_from_marking(G1CollectionSetCandi
     _contains_map[r->hrm_index()] = CandidateOrigin::Marking;
   }
   _last_marking_candidates_length = num_infos;
+  _marking_sorted_by_efficiency = false;
 
   verify();
 }
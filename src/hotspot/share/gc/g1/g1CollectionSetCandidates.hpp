@@ -190,6 +190,10 @@ class G1CollectionSetCandidates : public CHeapObj<mtGC> {
   // The number of regions from the last merge of candidates from the marking.
   uint _last_marking_candidates_length;
 
+  // Whether the marking regions have already been sorted by up-to-date gc
+  // efficiency after the remembered sets have been rebuilt.
+  bool _marking_sorted_by_efficiency;
+
   bool is_from_marking(HeapRegion* r) const;
 
 public:
@@ -216,6 +220,14 @@ class G1CollectionSetCandidates : public CHeapObj<mtGC> {
 
   void sort_marking_by_efficiency();
 
+  // Incremental sorting of the marking regions by gc efficiency, to be used
+  // concurrently while mixed gcs can not occur. First call calc_marking_efficiency()
+  // for all ranges of marking regions, then sort them with
+  // sort_marking_by_calculated_efficiency(). A subsequent sort_marking_by_efficiency()
+  // is a no-op then.
+  void calc_marking_efficiency(uint from, uint to);
+  void sort_marking_by_calculated_efficiency();
+
   // Add the given region to the set of retained regions without regards to the
   // gc efficiency sorting. The retained regions must be re-sorted manually later.
   void add_retained_region_unsorted(HeapRegion* r);
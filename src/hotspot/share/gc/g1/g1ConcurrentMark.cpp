@@ -2031,6 +2031,31 @@ void G1ConcurrentMark::rebuild_and_scrub() {
   G1ConcurrentRebuildAndScrub::rebuild_and_scrub(this, needs_remembered_set_rebuild(), _concurrent_workers);
 }
 
+void G1ConcurrentMark::sort_collection_set_candidates() {
+  if (!needs_remembered_set_rebuild()) {
+    return;
+  }
+
+  // Number of regions to calculate the gc efficiency for between yield checks.
+  const uint ChunkSize = 256;
+
+  SuspendibleThreadSetJoiner sts_join;
+  G1CollectionSetCandidates* candidates = _g1h->policy()->candidates();
+
+  for (uint from = 0; from < candidates->marking_regions_length(); from += ChunkSize) {
+    // A full gc clears the candidates and aborts marking while we yield.
+    if (do_yield_check() && has_aborted()) {
+      return;
+    }
+    uint to = MIN2(from + ChunkSize, candidates->marking_regions_length());
+    candidates->calc_marking_efficiency(from, to);
+  }
+  if (do_yield_check() && has_aborted()) {
+    return;
+  }
+  candidates->sort_marking_by_calculated_efficiency();
+}
+
 void G1ConcurrentMark::print_stats() {
   if (!log_is_enabled(Debug, gc, stats)) {
     return;
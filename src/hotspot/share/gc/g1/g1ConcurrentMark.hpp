@@ -721,6 +721,11 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   // to the application. Also scrubs dead objects to ensure region is parsable.
   void rebuild_and_scrub();
 
+  // Calculates the gc efficiency of the collection set candidates from marking
+  // after their remembered sets have been rebuilt and sorts them, yielding
+  // between chunks of regions. Keeps this work out of the Cleanup pause.
+  void sort_collection_set_candidates();
+
   uint needs_remembered_set_rebuild() const { return _needs_remembered_set_rebuild; }
 };
 
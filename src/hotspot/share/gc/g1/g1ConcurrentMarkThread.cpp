@@ -246,6 +246,12 @@ bool G1ConcurrentMarkThread::phase_rebuild_and_scrub() {
   return _cm->has_aborted();
 }
 
+bool G1ConcurrentMarkThread::phase_sort_collection_set_candidates() {
+  G1ConcPhaseTimer p(_cm, "Concurrent Sort Collection Set Candidates");
+  _cm->sort_collection_set_candidates();
+  return _cm->has_aborted();
+}
+
 bool G1ConcurrentMarkThread::phase_delay_to_keep_mmu_before_cleanup() {
   delay_to_keep_mmu(false /* cleanup */);
   return _cm->has_aborted();
@@ -299,16 +305,19 @@ void G1ConcurrentMarkThread::concurrent_mark_cycle_do() {
   // Phase 3: Rebuild remembered sets and scrub dead objects.
   if (phase_rebuild_and_scrub()) return;
 
-  // Phase 4: Wait for Cleanup.
+  // Phase 4: Sort collection set candidates by gc efficiency.
+  if (phase_sort_collection_set_candidates()) return;
+
+  // Phase 5: Wait for Cleanup.
   if (phase_delay_to_keep_mmu_before_cleanup()) return;
 
-  // Phase 5: Cleanup pause
+  // Phase 6: Cleanup pause
   if (phase_cleanup()) return;
 
-  // Phase 6: Clear CLD claimed marks.
+  // Phase 7: Clear CLD claimed marks.
   if (phase_clear_cld_claimed_marks()) return;
 
-  // Phase 7: Clear bitmap for next mark.
+  // Phase 8: Clear bitmap for next mark.
   phase_clear_bitmap_for_next_mark();
 }
 
@@ -66,6 +66,7 @@ class G1ConcurrentMarkThread: public ConcurrentGCThread {
   bool subphase_remark();
 
   bool phase_rebuild_and_scrub();
+  bool phase_sort_collection_set_candidates();
   bool phase_delay_to_keep_mmu_before_cleanup();
   bool phase_cleanup();
   bool phase_clear_bitmap_for_next_mark();
@@ -362,9 +362,10 @@ void G1ConcurrentRefine::adjust_threads_wanted(size_t available_bytes) {
   Atomic::store(&_threads_wanted, new_wanted);
   _dcqs.set_mutator_refinement_threshold(mutator_threshold);
   log_debug(gc, refine)("Concurrent refinement: wanted %u, cards: %zu, "
-                        "predicted: %zu, time: %1.2fms",
+                        "target: %zu, predicted: %zu, time: %1.2fms",
                         new_wanted,
                         num_cards,
+                        _threads_needed.target_cards(),
                         _threads_needed.predicted_cards_at_next_gc(),
                         _threads_needed.predicted_time_until_next_gc_ms());
   // Activate newly wanted threads.  The current thread is the primary
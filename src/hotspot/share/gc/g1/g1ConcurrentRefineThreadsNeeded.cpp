@@ -24,9 +24,11 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1Analytics.hpp"
+#include "gc/g1/g1CollectorState.hpp"
 #include "gc/g1/g1ConcurrentRefineThreadsNeeded.hpp"
 #include "gc/g1/g1HeapRegion.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include <math.h>
 
@@ -36,9 +38,44 @@ G1ConcurrentRefineThreadsNeeded::G1ConcurrentRefineThreadsNeeded(G1Policy* polic
   _update_period_ms(update_period_ms),
   _predicted_time_until_next_gc_ms(0.0),
   _predicted_cards_at_next_gc(0),
+  _target_cards(0),
   _threads_needed(0)
 {}
 
+// The target number of pending cards is derived from the time spent on
+// logged cards in past pauses.  That does not account for the rest of the
+// next pause; if copying the young gen is predicted to take up most of the
+// pause time goal, the merge and scan cost of the pending cards may push the
+// pause over it.  So limit the target to the number of cards whose predicted
+// cost fits into the remaining pause budget.
+size_t G1ConcurrentRefineThreadsNeeded::pause_goal_target_cards(size_t target_num_cards) const {
+  if (!G1UsePauseGoalRefinementTarget || target_num_cards == 0) {
+    return target_num_cards;
+  }
+
+  const G1Analytics* analytics = _policy->analytics();
+  bool for_young_only_phase = _policy->collector_state()->in_young_only_phase();
+
+  double target_cards_ms = analytics->predict_card_merge_time_ms(target_num_cards, for_young_only_phase) +
+                           analytics->predict_card_scan_time_ms(target_num_cards, for_young_only_phase);
+  if (target_cards_ms == 0.0) {
+    // No cost predictions yet.
+    return target_num_cards;
+  }
+  double cost_per_card_ms = target_cards_ms / target_num_cards;
+
+  uint young_length = _policy->young_list_target_length();
+  double other_ms = _policy->predict_base_time_ms(0) +
+                    _policy->predict_eden_copy_time_ms(young_length) +
+                    _policy->predict_young_region_other_time_ms(young_length);
+  double budget_ms = MAX2(_policy->max_pause_time_ms() - other_ms, 0.0);
+
+  // The remaining budget is only a rough estimate, so do not let it lower the
+  // target too far.
+  size_t budget_cards = static_cast<size_t>(MIN2(budget_ms / cost_per_card_ms, (double)SIZE_MAX));
+  return clamp(budget_cards, target_num_cards / 2, target_num_cards);
+}
+
 // Estimate how many concurrent refinement threads we need to run to achieve
 // the target number of card by the time the next GC happens.  There are
 // several secondary goals we'd like to achieve while meeting that goal.
@@ -57,6 +94,9 @@ void G1ConcurrentRefineThreadsNeeded::update(uint active_threads,
                                              size_t target_num_cards) {
   const G1Analytics* analytics = _policy->analytics();
 
+  target_num_cards = pause_goal_target_cards(target_num_cards);
+  _target_cards = target_num_cards;
+
   // Estimate time until next GC, based on remaining bytes available for
   // allocation and the allocation rate.
   double alloc_region_rate = analytics->predict_alloc_rate_ms();
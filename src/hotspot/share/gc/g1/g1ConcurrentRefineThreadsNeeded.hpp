@@ -39,8 +39,13 @@ class G1ConcurrentRefineThreadsNeeded : public CHeapObj<mtGC> {
   double _update_period_ms;
   double _predicted_time_until_next_gc_ms;
   size_t _predicted_cards_at_next_gc;
+  size_t _target_cards;
   uint _threads_needed;
 
+  // Returns the target number of pending cards, possibly lowered so that
+  // merging and scanning them fits into what is left of the pause time goal.
+  size_t pause_goal_target_cards(size_t target_num_cards) const;
+
 public:
   G1ConcurrentRefineThreadsNeeded(G1Policy* policy, double update_period_ms);
 
@@ -65,6 +70,9 @@ class G1ConcurrentRefineThreadsNeeded : public CHeapObj<mtGC> {
   size_t predicted_cards_at_next_gc() const {
     return _predicted_cards_at_next_gc;
   }
+
+  // The target number of pending cards used by the last update.
+  size_t target_cards() const { return _target_cards; }
 };
 
 #endif // SHARE_GC_G1_G1CONCURRENTREFINETHREADSNEEDED_HPP
@@ -127,7 +127,14 @@ G1EvacStats::G1EvacStats(const char* description, size_t default_per_thread_plab
   _direct_allocated(0),
   _num_direct_allocated(0),
   _failure_used(0),
-  _failure_waste(0) {
+  _failure_waste(0),
+  _worker_plab_sizes(nullptr) {
+  if (G1PerWorkerPLABSizing) {
+    _worker_plab_sizes = NEW_C_HEAP_ARRAY(size_t, ParallelGCThreads, mtGC);
+    for (uint i = 0; i < ParallelGCThreads; i++) {
+      _worker_plab_sizes[i] = 0;
+    }
+  }
 }
 
 // Calculates plab size for current number of gc worker threads.
@@ -140,6 +147,20 @@ size_t G1EvacStats::desired_plab_size(uint no_of_gc_workers) const {
   return align_object_size(clamp(_desired_net_plab_size / no_of_gc_workers, min_size(), max_size()));
 }
 
+size_t G1EvacStats::desired_plab_size(uint no_of_gc_workers, uint worker_id) const {
+  if (!ResizePLAB || _worker_plab_sizes == nullptr ||
+      worker_id >= ParallelGCThreads || _worker_plab_sizes[worker_id] == 0) {
+    return desired_plab_size(no_of_gc_workers);
+  }
+  return align_object_size(clamp(_worker_plab_sizes[worker_id], min_size(), max_size()));
+}
+
+void G1EvacStats::record_worker_plab_size(uint worker_id, size_t plab_size) {
+  if (_worker_plab_sizes != nullptr && worker_id < ParallelGCThreads) {
+    _worker_plab_sizes[worker_id] = plab_size;
+  }
+}
+
 void G1EvacStats::adjust_desired_plab_size() {
   log_plab_allocation();
 
@@ -50,6 +50,10 @@ class G1EvacStats : public PLABStats {
   // end of regions.
   size_t _failure_waste;
 
+  // The PLAB size every worker starts the next gc with if G1PerWorkerPLABSizing
+  // is enabled. Zero if there is no information about the worker.
+  size_t* _worker_plab_sizes;
+
   virtual void reset() {
     PLABStats::reset();
     _region_end_waste = 0;
@@ -71,6 +75,12 @@ class G1EvacStats : public PLABStats {
 
   // Calculates plab size for current number of gc worker threads.
   size_t desired_plab_size(uint no_of_gc_workers) const;
+  // Calculates plab size for the given worker, taking the PLAB size that
+  // worker ended the previous gc with into account.
+  size_t desired_plab_size(uint no_of_gc_workers, uint worker_id) const;
+
+  // Records the PLAB size the given worker should start the next gc with.
+  void record_worker_plab_size(uint worker_id, size_t plab_size);
 
   // Computes the new desired PLAB size assuming one gc worker thread, updating
   // _desired_plab_sz, and clearing statistics for the next GC.
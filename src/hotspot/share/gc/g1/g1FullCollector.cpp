@@ -136,9 +136,13 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap,
 
   _live_stats = NEW_C_HEAP_ARRAY(G1RegionMarkStats, _heap->max_regions(), mtGC);
   _compaction_tops = NEW_C_HEAP_ARRAY(HeapWord*, _heap->max_regions(), mtGC);
+  _compaction_first_dests = NEW_C_HEAP_ARRAY(uint, _heap->max_regions(), mtGC);
+  _compaction_last_dests = NEW_C_HEAP_ARRAY(uint, _heap->max_regions(), mtGC);
   for (uint j = 0; j < heap->max_regions(); j++) {
     _live_stats[j].clear();
     _compaction_tops[j] = nullptr;
+    _compaction_first_dests[j] = j;
+    _compaction_last_dests[j] = j;
   }
 
   for (uint i = 0; i < _num_workers; i++) {
@@ -161,6 +165,8 @@ G1FullCollector::~G1FullCollector() {
   FREE_C_HEAP_ARRAY(G1FullGCMarker*, _markers);
   FREE_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _compaction_points);
   FREE_C_HEAP_ARRAY(HeapWord*, _compaction_tops);
+  FREE_C_HEAP_ARRAY(uint, _compaction_first_dests);
+  FREE_C_HEAP_ARRAY(uint, _compaction_last_dests);
   FREE_C_HEAP_ARRAY(G1RegionMarkStats, _live_stats);
 }
 
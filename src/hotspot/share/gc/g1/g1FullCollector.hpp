@@ -98,6 +98,10 @@ class G1FullCollector : StackObj {
 
   HeapWord* volatile* _compaction_tops;
 
+  // The first and last region the live objects of a region are compacted into.
+  uint* _compaction_first_dests;
+  uint* _compaction_last_dests;
+
 public:
   G1FullCollector(G1CollectedHeap* heap,
                   bool clear_soft_refs,
@@ -141,6 +145,10 @@ class G1FullCollector : StackObj {
   inline void set_compaction_top(HeapRegion* r, HeapWord* value);
   inline HeapWord* compaction_top(HeapRegion* r) const;
 
+  inline void set_compaction_dests(HeapRegion* r, uint first_dest, uint last_dest);
+  inline uint compaction_first_dest(uint region_idx) const;
+  inline uint compaction_last_dest(uint region_idx) const;
+
   inline void set_has_compaction_targets();
   inline bool has_compaction_targets() const;
 
@@ -70,6 +70,19 @@ HeapWord* G1FullCollector::compaction_top(HeapRegion* r) const {
   return Atomic::load(&_compaction_tops[r->hrm_index()]);
 }
 
+void G1FullCollector::set_compaction_dests(HeapRegion* r, uint first_dest, uint last_dest) {
+  _compaction_first_dests[r->hrm_index()] = first_dest;
+  _compaction_last_dests[r->hrm_index()] = last_dest;
+}
+
+uint G1FullCollector::compaction_first_dest(uint region_idx) const {
+  return _compaction_first_dests[region_idx];
+}
+
+uint G1FullCollector::compaction_last_dest(uint region_idx) const {
+  return _compaction_last_dests[region_idx];
+}
+
 void G1FullCollector::set_has_compaction_targets() {
   if (!_has_compaction_targets) {
     _has_compaction_targets = true;
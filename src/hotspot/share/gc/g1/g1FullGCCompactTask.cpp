@@ -32,8 +32,50 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/spinYield.hpp"
 #include "utilities/ticks.hpp"
 
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+  G1FullGCTask("G1 Compact Task", collector),
+  _collector(collector),
+  _claimer(collector->workers()),
+  _g1h(G1CollectedHeap::heap()),
+  _region_states(nullptr),
+  _queue_positions(nullptr),
+  _first_unclaimed(nullptr),
+  _num_unclaimed(0) {
+  if (!G1FullGCBalancedCompaction) {
+    return;
+  }
+
+  uint max_regions = _g1h->max_regions();
+  _region_states = NEW_C_HEAP_ARRAY(uint8_t, max_regions, mtGC);
+  _queue_positions = NEW_C_HEAP_ARRAY(int, max_regions, mtGC);
+  _first_unclaimed = NEW_C_HEAP_ARRAY(int, collector->workers(), mtGC);
+  for (uint i = 0; i < max_regions; i++) {
+    _region_states[i] = Unclaimed;
+    _queue_positions[i] = -1;
+  }
+
+  for (uint i = 0; i < collector->workers(); i++) {
+    GrowableArray<HeapRegion*>* queue = collector->compaction_point(i)->regions();
+    for (int pos = 0; pos < queue->length(); pos++) {
+      _queue_positions[queue->at(pos)->hrm_index()] = pos;
+    }
+    _first_unclaimed[i] = 0;
+    _num_unclaimed += (uint)queue->length();
+  }
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  if (_region_states != nullptr) {
+    FREE_C_HEAP_ARRAY(uint8_t, _region_states);
+    FREE_C_HEAP_ARRAY(int, _queue_positions);
+    FREE_C_HEAP_ARRAY(int, _first_unclaimed);
+  }
+}
+
 void G1FullGCCompactTask::G1CompactRegionClosure::clear_in_bitmap(oop obj) {
   assert(_bitmap->is_marked(obj), "Should only compact marked objects");
   _bitmap->clear(obj);
@@ -85,8 +127,109 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
   hr->reset_compacted_after_full_gc(_collector->compaction_top(hr));
 }
 
+bool G1FullGCCompactTask::try_claim(HeapRegion* hr) {
+  volatile uint8_t* state = &_region_states[hr->hrm_index()];
+  if (Atomic::load(state) != Unclaimed ||
+      Atomic::cmpxchg(state, (uint8_t)Unclaimed, (uint8_t)Claimed) != Unclaimed) {
+    return false;
+  }
+  Atomic::dec(&_num_unclaimed);
+  return true;
+}
+
+bool G1FullGCCompactTask::is_compacted(HeapRegion* hr) const {
+  return Atomic::load_acquire(&_region_states[hr->hrm_index()]) == Compacted;
+}
+
+bool G1FullGCCompactTask::dependencies_compacted(GrowableArray<HeapRegion*>* queue, HeapRegion* hr) const {
+  uint region_idx = hr->hrm_index();
+  int pos = _queue_positions[region_idx];
+  int first = _queue_positions[_collector->compaction_first_dest(region_idx)];
+  int last = _queue_positions[_collector->compaction_last_dest(region_idx)];
+  assert(0 <= first && first <= last && last <= pos, "destinations of region %u must precede it in its queue", region_idx);
+
+  for (int i = first; i <= last; i++) {
+    // Compaction into the region itself is handled by the sliding copy.
+    if (i != pos && !is_compacted(queue->at(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void G1FullGCCompactTask::compact_claimed_region(HeapRegion* hr) {
+  compact_region(hr);
+  // Publish the compacted contents to workers waiting to compact into hr.
+  Atomic::release_store(&_region_states[hr->hrm_index()], (uint8_t)Compacted);
+}
+
+void G1FullGCCompactTask::compact_own_queue_balanced(uint worker_id) {
+  GrowableArray<HeapRegion*>* queue = collector()->compaction_point(worker_id)->regions();
+  for (int pos = 0; pos < queue->length(); pos++) {
+    HeapRegion* hr = queue->at(pos);
+    if (!try_claim(hr)) {
+      // Taken over by another worker.
+      continue;
+    }
+    Atomic::store(&_first_unclaimed[worker_id], pos + 1);
+
+    // All destinations precede hr in this queue, so they have been claimed
+    // already and are either compacted or being compacted by another worker.
+    SpinYield spin_yield;
+    while (!dependencies_compacted(queue, hr)) {
+      spin_yield.wait();
+    }
+    compact_claimed_region(hr);
+  }
+}
+
+bool G1FullGCCompactTask::steal_from_queue(uint queue_id) {
+  GrowableArray<HeapRegion*>* queue = collector()->compaction_point(queue_id)->regions();
+  int start = Atomic::load(&_first_unclaimed[queue_id]);
+  // Skip regions that have been claimed since the last update of the hint.
+  while (start < queue->length() &&
+         Atomic::load(&_region_states[queue->at(start)->hrm_index()]) != Unclaimed) {
+    start++;
+  }
+  Atomic::store(&_first_unclaimed[queue_id], start);
+
+  // Regions further up the queue are unlikely to have all their destinations
+  // compacted yet, so only look at a window of regions.
+  int end = MIN2(start + StealWindowSize, queue->length());
+  bool stolen = false;
+  for (int pos = start; pos < end; pos++) {
+    HeapRegion* hr = queue->at(pos);
+    if (dependencies_compacted(queue, hr) && try_claim(hr)) {
+      compact_claimed_region(hr);
+      stolen = true;
+    }
+  }
+  return stolen;
+}
+
+void G1FullGCCompactTask::steal_regions(uint worker_id) {
+  uint num_queues = collector()->workers();
+  SpinYield spin_yield;
+  while (Atomic::load(&_num_unclaimed) > 0) {
+    bool stolen = false;
+    for (uint i = 1; i < num_queues; i++) {
+      stolen |= steal_from_queue((worker_id + i) % num_queues);
+    }
+    if (!stolen) {
+      // The remaining regions depend on regions still being compacted.
+      spin_yield.wait();
+    }
+  }
+}
+
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
+  if (G1FullGCBalancedCompaction) {
+    compact_own_queue_balanced(worker_id);
+    steal_regions(worker_id);
+    return;
+  }
+
   GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
   for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
        it != compaction_queue->end();
@@ -40,6 +40,34 @@ class G1FullGCCompactTask : public G1FullGCTask {
   HeapRegionClaimer _claimer;
   G1CollectedHeap* _g1h;
 
+  // Balanced compaction (G1FullGCBalancedCompaction): a region in a compaction
+  // queue may be compacted by any worker once all regions its live objects are
+  // compacted into, other than itself, have been compacted. Workers first
+  // compact their own queue in order, then take over regions from other queues.
+  enum RegionState : uint8_t {
+    Unclaimed,
+    Claimed,
+    Compacted
+  };
+  // Number of regions after the first unclaimed region of a queue that are
+  // considered when looking for regions to take over.
+  static const int StealWindowSize = 16;
+
+  volatile uint8_t* _region_states;
+  // Position of a region in its compaction queue.
+  int* _queue_positions;
+  // Lower bound of the position of the first unclaimed region per queue.
+  volatile int* _first_unclaimed;
+  volatile uint _num_unclaimed;
+
+  bool try_claim(HeapRegion* hr);
+  bool is_compacted(HeapRegion* hr) const;
+  bool dependencies_compacted(GrowableArray<HeapRegion*>* queue, HeapRegion* hr) const;
+  void compact_claimed_region(HeapRegion* hr);
+  void compact_own_queue_balanced(uint worker_id);
+  bool steal_from_queue(uint queue_id);
+  void steal_regions(uint worker_id);
+
   void compact_region(HeapRegion* hr);
   void compact_humongous_obj(HeapRegion* hr);
   void free_non_overlapping_regions(uint src_start_idx, uint dest_start_idx, uint num_regions);
@@ -47,11 +75,8 @@ class G1FullGCCompactTask : public G1FullGCTask {
   static void copy_object_to_new_location(oop obj);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _collector(collector),
-    _claimer(collector->workers()),
-    _g1h(G1CollectedHeap::heap()) { }
+  G1FullGCCompactTask(G1FullCollector* collector);
+  ~G1FullGCCompactTask();
 
   void work(uint worker_id);
   void serial_compaction();
@@ -115,7 +115,11 @@ size_t G1FullGCPrepareTask::G1PrepareCompactLiveClosure::apply(oop object) {
 
 void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(HeapRegion* hr) {
   if (!_collector->is_free(hr->hrm_index())) {
+    // Remember the range of regions the objects are compacted into. These
+    // are the regions that must be compacted before this one.
+    uint first_dest = _cp->current_region()->hrm_index();
     G1PrepareCompactLiveClosure prepare_compact(_cp);
     hr->apply_to_marked_objects(_bitmap, &prepare_compact);
+    _collector->set_compaction_dests(hr, first_dest, _cp->current_region()->hrm_index());
   }
 }
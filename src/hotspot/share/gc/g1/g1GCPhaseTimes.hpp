@@ -125,6 +125,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     ScanHRScannedBlocks,
     ScanHRClaimedChunks,
     ScanHRFoundRoots,
+    ScanHRPrefetchedBlocks,
     ScanHRScannedOptRefs,
     ScanHRUsedMemory
   };
@@ -299,11 +299,15 @@ uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
 
     uint start = range.start();
     uint num_regions = MIN2(range.length(), limit - uncommitted);
+    // Complete the last heap page, otherwise its memory is not returned
+    // to the OS until the next invocation.
+    uint page_end = align_up(start + num_regions, regions_per_heap_page());
+    num_regions = MIN2(range.length(), page_end - start);
     uncommitted += num_regions;
     uncommit_regions(start, num_regions);
   } while (uncommitted < limit);
 
-  assert(uncommitted == limit, "Invariant");
+  assert(uncommitted >= limit, "Invariant");
   return uncommitted;
 }
 
@@ -621,8 +625,12 @@ uint HeapRegionManager::shrink_by(uint num_regions_to_remove) {
   while ((removed < num_regions_to_remove) &&
       (num_last_found = find_empty_from_idx_reverse(cur, &idx_last_found)) > 0) {
     uint to_remove = MIN2(num_regions_to_remove - removed, num_last_found);
+    uint start = idx_last_found + num_last_found - to_remove;
 
-    shrink_at(idx_last_found + num_last_found - to_remove, to_remove);
+    to_remove = align_to_heap_pages(&start, idx_last_found + num_last_found);
+    if (to_remove > 0) {
+      shrink_at(start, to_remove);
+    }
 
     cur = idx_last_found;
     removed += to_remove;
@@ -645,6 +653,46 @@ void HeapRegionManager::shrink_at(uint index, size_t num_regions) {
   deactivate_regions(index, (uint) num_regions);
 }
 
+uint HeapRegionManager::regions_per_heap_page() const {
+  return (uint)_heap_mapper->regions_per_page();
+}
+
+bool HeapRegionManager::is_unavailable_range(uint start, uint end) const {
+  for (uint i = start; i < end; i++) {
+    if (is_available(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint HeapRegionManager::align_to_heap_pages(uint* start, uint end) const {
+  uint regions_per_page = regions_per_heap_page();
+  if (regions_per_page == 1) {
+    return end - *start;
+  }
+
+  uint aligned_start = align_down(*start, regions_per_page);
+  if (!is_unavailable_range(aligned_start, *start)) {
+    aligned_start += regions_per_page;
+  } else {
+    aligned_start = *start;
+  }
+
+  uint aligned_end = align_up(end, regions_per_page);
+  if (!is_unavailable_range(end, MIN2(aligned_end, reserved_length()))) {
+    aligned_end = align_down(end, regions_per_page);
+  } else {
+    aligned_end = end;
+  }
+
+  if (aligned_start >= aligned_end) {
+    return 0;
+  }
+  *start = aligned_start;
+  return aligned_end - aligned_start;
+}
+
 uint HeapRegionManager::find_empty_from_idx_reverse(uint start_idx, uint* res_idx) const {
   guarantee(start_idx <= _allocated_heapregions_length, "checking");
   guarantee(res_idx != nullptr, "checking");
@@ -111,6 +111,15 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // sequence could be found, otherwise res_idx contains the start index of this range.
   uint find_empty_from_idx_reverse(uint start_idx, uint* res_idx) const;
 
+  // Number of regions sharing a single commit page of the heap.
+  uint regions_per_heap_page() const;
+  // Returns whether all regions in [start, end) are unavailable.
+  bool is_unavailable_range(uint start, uint end) const;
+  // Shrinks the given range of regions to regions whose heap pages are completely
+  // unavailable after deactivating the range. Deactivating other regions would not
+  // return any memory to the OS. Returns the length of the adjusted range.
+  uint align_to_heap_pages(uint* start, uint end) const;
+
   // Checks the G1MemoryNodeManager to see if this region is on the preferred node.
   bool is_on_preferred_index(uint region_index, uint preferred_node_index);
 
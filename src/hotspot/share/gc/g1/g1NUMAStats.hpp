@@ -87,6 +87,9 @@ class G1NUMAStats : public CHeapObj<mtGC> {
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Statistics of the source region node versus the destination region
+    // node during copy to survivor region.
+    SourceNodeAtCopyToSurv,
     NodeDataItemsSentinel
   };
 
@@ -86,6 +86,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
     _obj_alloc_stat(nullptr),
+    _obj_dest_stat(nullptr),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
     _evacuation_failed_info(),
@@ -103,7 +104,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
   _surviving_young_words = _surviving_young_words_base + padding_elem_num;
   memset(_surviving_young_words, 0, _surviving_words_length * sizeof(size_t));
 
-  _plab_allocator = new G1PLABAllocator(_g1h->allocator());
+  _plab_allocator = new G1PLABAllocator(_g1h->allocator(), worker_id);
 
   _closures = G1EvacuationRootClosures::create_root_closures(_g1h,
                                                              this,
@@ -139,6 +140,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _obj_dest_stat);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -420,6 +422,9 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
   }
   if (obj_ptr != nullptr) {
     update_numa_stats(node_index);
+    if (dest_attr->is_young()) {
+      update_numa_dest_stats(node_index, obj_ptr);
+    }
     if (_g1h->gc_tracer_stw()->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, old, word_sz, age, obj_ptr, node_index);
@@ -685,6 +690,8 @@ void G1ParScanThreadState::initialize_numa_stats() {
       // Record only if there are multiple active nodes.
       _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
       memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _obj_dest_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes * num_nodes, mtGC);
+      memset(_obj_dest_stat, 0, sizeof(size_t) * num_nodes * num_nodes);
     }
   }
 }
@@ -694,6 +701,12 @@ void G1ParScanThreadState::flush_numa_stats() {
     uint node_index = _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
   }
+  if (_obj_dest_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    for (uint i = 0; i < num_nodes; i++) {
+      _numa->copy_statistics(G1NUMAStats::SourceNodeAtCopyToSurv, i, &_obj_dest_stat[i * num_nodes]);
+    }
+  }
 }
 
 void G1ParScanThreadState::update_numa_stats(uint node_index) {
@@ -702,6 +715,16 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+void G1ParScanThreadState::update_numa_dest_stats(uint node_index, HeapWord* obj_ptr) {
+  if (_obj_dest_stat != nullptr) {
+    uint dest_node_index = _g1h->heap_region_containing(obj_ptr)->node_index();
+    uint num_nodes = _numa->num_active_nodes();
+    if (node_index < num_nodes && dest_node_index < num_nodes) {
+      _obj_dest_stat[node_index * num_nodes + dest_node_index]++;
+    }
+  }
+}
+
 G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                                                  uint num_workers,
                                                  G1CollectionSet* collection_set,
@@ -102,6 +102,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Records, per node of the source region, at which node the destination
+  // survivor region of object allocations during copy to survivor is. Recorded
+  // and transferred like _obj_alloc_stat, laid out as (source node * num nodes
+  // + destination node).
+  size_t* _obj_dest_stat;
 
   // Per-thread evacuation failure data structures.
   ALLOCATION_FAILURE_INJECTOR_ONLY(size_t _allocation_failure_inject_counter;)
@@ -219,6 +224,7 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  void update_numa_dest_stats(uint node_index, HeapWord* obj_ptr);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
@@ -72,6 +72,10 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   virtual void commit_regions(uint start_idx, size_t num_regions = 1, WorkerThreads* pretouch_workers = nullptr) = 0;
   virtual void uncommit_regions(uint start_idx, size_t num_regions = 1) = 0;
 
+  // Number of regions sharing a single commit page. Memory of these regions
+  // can only be returned to the OS once all of them have been uncommitted.
+  virtual size_t regions_per_page() const { return 1; }
+
   // Creates an appropriate G1RegionToSpaceMapper for the given parameters.
   // The actual space to be used within the given reservation is given by actual_size.
   // This is because some OSes need to round up the reservation size to guarantee
@@ -53,6 +53,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
@@ -499,6 +500,7 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   size_t _blocks_scanned;
   size_t _chunks_claimed;
   size_t _heap_roots_found;
+  size_t _blocks_prefetched;
 
   Tickspan _rem_set_root_scan_time;
   Tickspan _rem_set_trim_partially_time;
@@ -508,6 +510,11 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   HeapWord* _scanned_to;
   CardValue _scanned_card_value;
 
+  // With G1PrefetchScanHeapRoots, the dirty card block whose memory has been
+  // prefetched but which has not been scanned yet.
+  CardValue* _pending_dirty_l;
+  CardValue* _pending_dirty_r;
+
   HeapWord* scan_memregion(uint region_idx_for_card, MemRegion mr) {
     HeapRegion* const card_region = _g1h->region_at(region_idx_for_card);
     G1ScanCardClosure card_cl(_g1h, _pss, _heap_roots_found);
@@ -541,6 +548,29 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
     _cards_scanned += num_cards;
   }
 
+  // Issue prefetches for the BOT entry and the first card of the given dirty
+  // card block, then scan the previously pending block. This overlaps the memory
+  // latency of the next block start lookup with scanning the current block.
+  void prefetch_and_scan_pending_block(uint const region_idx, CardValue* const dirty_l, CardValue* const dirty_r) {
+    HeapWord* const card_start = _ct->addr_for(dirty_l);
+    if (card_start < _scan_state->scan_top(region_idx)) {
+      _g1h->bot()->prefetch_entry_for(card_start);
+      Prefetch::read(card_start, 0);
+      _blocks_prefetched++;
+    }
+    flush_pending_block(region_idx);
+    _pending_dirty_l = dirty_l;
+    _pending_dirty_r = dirty_r;
+  }
+
+  void flush_pending_block(uint const region_idx) {
+    if (_pending_dirty_l != nullptr) {
+      do_claimed_block(region_idx, _pending_dirty_l, _pending_dirty_r);
+      _pending_dirty_l = nullptr;
+      _pending_dirty_r = nullptr;
+    }
+  }
+
   // To locate consecutive dirty cards inside a chunk.
   class ChunkScanner {
     using Word = size_t;
@@ -661,10 +691,19 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
       CardValue* const end_card = start_card + claim.size();
 
       ChunkScanner chunk_scanner{start_card, end_card};
-      chunk_scanner.on_dirty_cards([&] (CardValue* dirty_l, CardValue* dirty_r) {
-                                     do_claimed_block(region_idx, dirty_l, dirty_r);
-                                   });
+      if (G1PrefetchScanHeapRoots) {
+        chunk_scanner.on_dirty_cards([&] (CardValue* dirty_l, CardValue* dirty_r) {
+                                       prefetch_and_scan_pending_block(region_idx, dirty_l, dirty_r);
+                                     });
+      } else {
+        chunk_scanner.on_dirty_cards([&] (CardValue* dirty_l, CardValue* dirty_r) {
+                                       do_claimed_block(region_idx, dirty_l, dirty_r);
+                                     });
+      }
     }
+    // The pending block is carried across chunk claims, but not across regions
+    // as the scan finger is reset for every region.
+    flush_pending_block(region_idx);
   }
 
 public:
@@ -683,11 +722,14 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
     _blocks_scanned(0),
     _chunks_claimed(0),
     _heap_roots_found(0),
+    _blocks_prefetched(0),
     _rem_set_root_scan_time(),
     _rem_set_trim_partially_time(),
     _scanned_to(nullptr),
     _scanned_card_value(remember_already_scanned_cards ? G1CardTable::g1_scanned_card_val()
-                                                       : G1CardTable::clean_card_val()) {
+                                                       : G1CardTable::clean_card_val()),
+    _pending_dirty_l(nullptr),
+    _pending_dirty_r(nullptr) {
   }
 
   bool do_heap_region(HeapRegion* r) {
@@ -710,6 +752,7 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   size_t blocks_scanned() const { return _blocks_scanned; }
   size_t chunks_claimed() const { return _chunks_claimed; }
   size_t heap_roots_found() const { return _heap_roots_found; }
+  size_t blocks_prefetched() const { return _blocks_prefetched; }
 };
 
 void G1RemSet::scan_heap_roots(G1ParScanThreadState* pss,
@@ -732,6 +775,7 @@ void G1RemSet::scan_heap_roots(G1ParScanThreadState* pss,
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.blocks_scanned(), G1GCPhaseTimes::ScanHRScannedBlocks);
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.chunks_claimed(), G1GCPhaseTimes::ScanHRClaimedChunks);
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.heap_roots_found(), G1GCPhaseTimes::ScanHRFoundRoots);
+  p->record_or_add_thread_work_item(scan_phase, worker_id, cl.blocks_prefetched(), G1GCPhaseTimes::ScanHRPrefetchedBlocks);
 }
 
 // Wrapper around a NMethodClosure to count the number of nmethods scanned.
@@ -38,6 +38,7 @@
 #include "gc/g1/g1EvacInfo.hpp"
 #include "gc/g1/g1HeapRegionPrinter.hpp"
 #include "gc/g1/g1MonitoringSupport.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
@@ -344,10 +345,13 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
+      // Without G1EagerReclaimHumongousObjArrays we only nominate
+      // is_typeArray() objects.  A humongous object containing references
+      // induces remembered set entries on other regions.  These entries
+      // become stale after reclaiming the object, the same as entries for
+      // any other freed region, which remembered set scanning and
+      // refinement already tolerate by filtering on region type and scan
+      // top.
       //
       // We also treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
@@ -359,10 +363,26 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
 
-      return obj->is_typeArray() &&
+      if (obj->is_typeArray()) {
+        return _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+
+      return G1EagerReclaimHumongousObjArrays &&
+             obj->is_objArray() &&
+             allocated_after_mark_start(region) &&
              _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
+    // Object arrays may be on the mark stack or need their references scanned
+    // for SATB if allocated before the start of concurrent marking. Concurrent
+    // rebuild skips regions reclaimed in the meantime.
+    bool allocated_after_mark_start(HeapRegion* region) const {
+      if (!_g1h->collector_state()->mark_or_rebuild_in_progress()) {
+        return true;
+      }
+      return _g1h->concurrent_mark()->top_at_mark_start(region) == region->bottom();
+    }
+
   public:
     G1PrepareRegionsClosure(G1CollectedHeap* g1h, G1PrepareEvacuationTask* parent_task) :
       _g1h(g1h),
@@ -375,12 +395,27 @@ class G1PrepareEvacuationTask : public WorkerTask {
       _parent_task->add_humongous_total(_worker_humongous_total);
     }
 
+    // Use the node the memory of collection set regions actually resides on
+    // as node of the region, so that live objects are evacuated to that node.
+    // The OS may have moved the pages since the region has been allocated.
+    void update_node_index(HeapRegion* hr) {
+      G1NUMA* numa = _g1h->numa();
+      if (G1NUMAQueryActualSourceNode && numa->is_enabled() && hr->in_collection_set()) {
+        uint node_index = numa->index_of_address(hr->bottom());
+        if (node_index != G1NUMA::UnknownNodeIndex) {
+          hr->set_node_index(node_index);
+        }
+      }
+    }
+
     virtual bool do_heap_region(HeapRegion* hr) {
       // First prepare the region for scanning
       _g1h->rem_set()->prepare_region_for_scan(hr);
 
       sample_card_set_size(hr);
 
+      update_node_index(hr);
+
       // Now check if region is a humongous candidate
       if (!hr->is_starts_humongous()) {
         _g1h->register_region_with_region_attr(hr);
@@ -396,7 +431,7 @@ class G1PrepareEvacuationTask : public WorkerTask {
         _g1h->register_region_with_region_attr(hr);
       }
       log_debug(gc, humongous)("Humongous region %u (object size %zu @ " PTR_FORMAT ") remset %zu code roots %zu "
-                               "marked %d pinned count %zu reclaim candidate %d type array %d",
+                               "marked %d pinned count %zu reclaim candidate %d type array %d obj array %d",
                                index,
                                cast_to_oop(hr->bottom())->size() * HeapWordSize,
                                p2i(hr->bottom()),
@@ -405,7 +440,8 @@ class G1PrepareEvacuationTask : public WorkerTask {
                                _g1h->concurrent_mark()->mark_bitmap()->is_marked(hr->bottom()),
                                hr->pinned_count(),
                                _g1h->is_humongous_reclaim_candidate(index),
-                               cast_to_oop(hr->bottom())->is_typeArray()
+                               cast_to_oop(hr->bottom())->is_typeArray(),
+                               cast_to_oop(hr->bottom())->is_objArray()
                               );
       _worker_humongous_total++;
 
@@ -335,6 +335,7 @@ G1PostEvacuateCollectionSetCleanupTask1::G1PostEvacuateCollectionSetCleanupTask1
 
 class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
   uint _humongous_objects_reclaimed;
+  uint _obj_arrays_reclaimed;
   uint _humongous_regions_reclaimed;
   size_t _freed_bytes;
   G1CollectedHeap* _g1h;
@@ -366,10 +367,9 @@ class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - object arrays are only considered with G1EagerReclaimHumongousObjArrays.
+  // Their outgoing references leave stale entries in remembered sets of other
+  // regions, which are not cleaned up.
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
@@ -377,6 +377,7 @@ class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
 public:
   G1FreeHumongousRegionClosure() :
     _humongous_objects_reclaimed(0),
+    _obj_arrays_reclaimed(0),
     _humongous_regions_reclaimed(0),
     _freed_bytes(0),
     _g1h(G1CollectedHeap::heap())
@@ -390,9 +391,12 @@ class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
     HeapRegion* r = _g1h->region_at(region_index);
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
-              PTR_FORMAT " is not.", p2i(r->bottom()));
+    guarantee(G1CollectedHeap::is_eager_reclaim_supported_type(obj),
+              "Eagerly reclaiming object " PTR_FORMAT " of this type is not supported.",
+              p2i(r->bottom()));
+    if (obj->is_objArray()) {
+      _obj_arrays_reclaimed++;
+    }
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
                              region_index,
@@ -425,6 +429,10 @@ class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
     return _humongous_objects_reclaimed;
   }
 
+  uint obj_arrays_reclaimed() {
+    return _obj_arrays_reclaimed;
+  }
+
   uint humongous_regions_reclaimed() {
     return _humongous_regions_reclaimed;
   }
@@ -445,18 +453,28 @@ class G1PostEvacuateCollectionSetCleanupTask2::UpdateDerivedPointersTask : publi
 #endif
 
 class G1PostEvacuateCollectionSetCleanupTask2::EagerlyReclaimHumongousObjectsTask : public G1AbstractSubTask {
+  uint _humongous_objects_reclaimed;
+  uint _obj_arrays_reclaimed;
   uint _humongous_regions_reclaimed;
   size_t _bytes_freed;
 
 public:
   EagerlyReclaimHumongousObjectsTask() :
     G1AbstractSubTask(G1GCPhaseTimes::EagerlyReclaimHumongousObjects),
+    _humongous_objects_reclaimed(0),
+    _obj_arrays_reclaimed(0),
     _humongous_regions_reclaimed(0),
     _bytes_freed(0) { }
 
   virtual ~EagerlyReclaimHumongousObjectsTask() {
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
+    log_debug(gc, humongous)("Eagerly reclaimed %u humongous objects (%u object arrays) in %u regions, " SIZE_FORMAT " bytes",
+                             _humongous_objects_reclaimed,
+                             _obj_arrays_reclaimed,
+                             _humongous_regions_reclaimed,
+                             _bytes_freed);
+
     g1h->remove_from_old_gen_sets(0, _humongous_regions_reclaimed);
     g1h->decrement_summary_bytes(_bytes_freed);
   }
@@ -472,6 +490,8 @@ class G1PostEvacuateCollectionSetCleanupTask2::EagerlyReclaimHumongousObjectsTas
     record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumCandidates, g1h->num_humongous_reclaim_candidates());
     record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumReclaimed, cl.humongous_objects_reclaimed());
 
+    _humongous_objects_reclaimed = cl.humongous_objects_reclaimed();
+    _obj_arrays_reclaimed = cl.obj_arrays_reclaimed();
     _humongous_regions_reclaimed = cl.humongous_regions_reclaimed();
     _bytes_freed = cl.bytes_freed();
   }
@@ -492,7 +512,7 @@ class G1PostEvacuateCollectionSetCleanupTask2::RestorePreservedMarksTask : publi
   }
 
   double worker_cost() const override {
-    return _preserved_marks->num();
+    return _preserved_marks->num_segments();
   }
 
   void do_work(uint worker_id) override { _task->work(worker_id); }
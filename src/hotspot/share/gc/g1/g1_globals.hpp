@@ -132,6 +132,11 @@
           "draining concurrent marking work queues.")                       \
           range(1, INT_MAX)                                                 \
                                                                             \
+  product(bool, G1PrefetchScanHeapRoots, false, EXPERIMENTAL,               \
+          "Pipeline heap root scanning by prefetching the block offset "    \
+          "table entry and the first card of the next dirty card block "    \
+          "while scanning the current one.")                                \
+                                                                            \
   product(bool, G1UseReferencePrecleaning, true, EXPERIMENTAL,              \
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
@@ -175,6 +180,28 @@
           "Control whether concurrent refinement is performed. "            \
           "Disabling effectively ignores G1RSetUpdatingPauseTimePercent")   \
                                                                             \
+  product(bool, G1NUMAQueryActualSourceNode, false, EXPERIMENTAL,           \
+          "With UseNUMA, query the node that the memory of collection set " \
+          "regions actually is on before evacuation, and evacuate their "   \
+          "objects to that node instead of the node the region has been "   \
+          "requested on.")                                                  \
+                                                                            \
+  product(bool, G1FullGCBalancedCompaction, false, EXPERIMENTAL,            \
+          "During the compaction phase of full gc, let workers that "       \
+          "finished their own compaction queue take over regions of other " \
+          "queues as soon as the destination regions of these regions "    \
+          "have been compacted.")                                           \
+                                                                            \
+  product(bool, G1PerWorkerPLABSizing, false, EXPERIMENTAL,                 \
+          "Start PLAB sizing of every gc worker with the PLAB size it "     \
+          "ended the previous gc with, halved if the worker wasted more "   \
+          "than TargetPLABWastePct of its PLABs. Requires ResizePLAB.")     \
+                                                                            \
+  product(bool, G1UsePauseGoalRefinementTarget, false, EXPERIMENTAL,        \
+          "Lower the pending cards target of concurrent refinement so "     \
+          "that their predicted merge and scan time fits into the pause "   \
+          "time goal left after the predicted young gen evacuation.")       \
+                                                                            \
   develop(uint, G1RemSetArrayOfCardsEntriesBase, 8,                         \
           "Maximum number of entries per region in the Array of Cards "     \
           "card set container per MB of a heap region.")                    \
@@ -186,6 +213,13 @@
           range(0, 65536)                                                   \
           constraint(G1RemSetArrayOfCardsEntriesConstraintFunc,AfterErgo)   \
                                                                             \
+  product(uint, G1RemSetArrayOfCardsRunsThreshold, 0, EXPERIMENTAL,         \
+          "Minimum number of adjacent card pairs in an inline card set "    \
+          "container for it to be coarsened into an Array of Cards "        \
+          "container storing card runs instead of single cards. "           \
+          "0 disables run encoding.")                                       \
+          range(0, 64)                                                      \
+                                                                            \
   product(uint, G1RemSetHowlMaxNumBuckets, 8, EXPERIMENTAL,                 \
           "Maximum number of buckets per Howl card set container. The "     \
           "default gives at worst bitmaps of size 8k. This showed to be a " \
@@ -268,6 +302,11 @@
           "otherwise eligible for eager reclaim may have to be a candidate "\
           "for eager reclaim. Will be selected ergonomically by default.")  \
                                                                             \
+  product(bool, G1EagerReclaimHumongousObjArrays, false, EXPERIMENTAL,      \
+          "Also eagerly reclaim humongous object arrays. During concurrent "\
+          "marking, only object arrays allocated after the start of "       \
+          "marking are candidates.")                                        \
+                                                                            \
   product(size_t, G1RebuildRemSetChunkSize, 256 * K, EXPERIMENTAL,          \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
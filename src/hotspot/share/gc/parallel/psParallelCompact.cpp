@@ -54,6 +54,7 @@
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.inline.hpp"
 #include "gc/shared/oopStorageSetParState.inline.hpp"
+#include "gc/shared/parallelCleaning.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
@@ -90,9 +91,6 @@
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/stack.inline.hpp"
-#if INCLUDE_JVMCI
-#include "jvmci/jvmci.hpp"
-#endif
 
 #include <math.h>
 
@@ -708,50 +706,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
+      summarize_region(split_info, cur_region, dest_addr);
       dest_addr += words;
     }
 
@@ -762,6 +717,174 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region(SplitInfo& split_info, size_t cur_region, HeapWord* dest_addr) {
+  size_t words = _region_data[cur_region].data_size();
+  assert(words > 0, "only for regions with data");
+
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+}
+
+// Summarizes the regions of a space that is compacted into itself, i.e. that
+// is known to fit without a split.  The destination of a region only depends
+// on the live words of the regions before it, so the regions are processed in
+// chunks with two parallel passes: the first sums up the live words of each
+// chunk, and after a prefix sum over the chunks the second summarizes each
+// chunk starting from its own destination.
+class PSSummarizeTask : public WorkerTask {
+  static const size_t RegionsPerChunk = 1024;
+
+  ParallelCompactData& _sd;
+  SplitInfo& _split_info;
+  const size_t _beg_region;
+  const size_t _end_region;
+  HeapWord* const _target_beg;
+  const size_t _num_chunks;
+  // Live words of each chunk, then the offset of its destination from _target_beg.
+  size_t* const _chunk_words;
+  bool _compute_destinations;
+  volatile size_t _claimed;
+
+  void sum_chunk(size_t chunk, size_t beg, size_t end) {
+    size_t words = 0;
+    for (size_t cur = beg; cur < end; ++cur) {
+      words += _sd.region(cur)->data_size();
+    }
+    _chunk_words[chunk] = words;
+  }
+
+  void summarize_chunk(size_t chunk, size_t beg, size_t end) {
+    HeapWord* dest_addr = _target_beg + _chunk_words[chunk];
+    for (size_t cur = beg; cur < end; ++cur) {
+      // The destination must be set even if the region has no data.
+      _sd.region(cur)->set_destination(dest_addr);
+      size_t words = _sd.region(cur)->data_size();
+      if (words > 0) {
+        _sd.summarize_region(_split_info, cur, dest_addr);
+        dest_addr += words;
+      }
+    }
+  }
+
+public:
+  PSSummarizeTask(ParallelCompactData& sd, SplitInfo& split_info,
+                  size_t beg_region, size_t end_region, HeapWord* target_beg) :
+    WorkerTask("PSSummarize task"),
+    _sd(sd),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _target_beg(target_beg),
+    _num_chunks(num_chunks(end_region - beg_region)),
+    _chunk_words(NEW_C_HEAP_ARRAY(size_t, _num_chunks, mtGC)),
+    _compute_destinations(false),
+    _claimed(0) {}
+
+  ~PSSummarizeTask() {
+    FREE_C_HEAP_ARRAY(size_t, _chunk_words);
+  }
+
+  static size_t num_chunks(size_t num_regions) {
+    return (num_regions + RegionsPerChunk - 1) / RegionsPerChunk;
+  }
+
+  // Turn the live words of the chunks into destination offsets and prepare
+  // for the second pass.  Returns the live words of all chunks.
+  size_t prefix_sum() {
+    size_t sum = 0;
+    for (size_t chunk = 0; chunk < _num_chunks; ++chunk) {
+      size_t words = _chunk_words[chunk];
+      _chunk_words[chunk] = sum;
+      sum += words;
+    }
+    _compute_destinations = true;
+    _claimed = 0;
+    return sum;
+  }
+
+  void work(uint worker_id) {
+    for (size_t chunk = Atomic::fetch_then_add(&_claimed, (size_t)1);
+         chunk < _num_chunks;
+         chunk = Atomic::fetch_then_add(&_claimed, (size_t)1)) {
+      size_t beg = _beg_region + chunk * RegionsPerChunk;
+      size_t end = MIN2(beg + RegionsPerChunk, _end_region);
+      if (_compute_destinations) {
+        summarize_chunk(chunk, beg, end);
+      } else {
+        sum_chunk(chunk, beg, end);
+      }
+    }
+  }
+};
+
+void PSParallelCompact::summarize_in_place(SpaceId id, HeapWord* source_beg) {
+  MutableSpace* const space = _space_info[id].space();
+  size_t beg_region = _summary_data.addr_to_region_idx(source_beg);
+  size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(space->top()));
+
+  WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+  uint num_workers = (uint)MIN2((size_t)workers.active_workers(),
+                                PSSummarizeTask::num_chunks(end_region - beg_region));
+  if (num_workers <= 1) {
+    bool done = _summary_data.summarize(_space_info[id].split_info(),
+                                        source_beg, space->top(), nullptr,
+                                        source_beg, space->end(),
+                                        _space_info[id].new_top_addr());
+    assert(done, "space must fit when compacted into itself");
+    return;
+  }
+
+  PSSummarizeTask task(_summary_data, _space_info[id].split_info(),
+                       beg_region, end_region, source_beg);
+  workers.run_task(&task, num_workers);
+  size_t live_words = task.prefix_sum();
+  assert(source_beg + live_words <= space->end(), "space must fit when compacted into itself");
+  workers.run_task(&task, num_workers);
+  _space_info[id].set_new_top(source_beg + live_words);
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) const {
   assert(addr != nullptr, "Should detect null oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
@@ -1186,10 +1309,7 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
       fill_dense_prefix_end(id);
       _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
-    _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
-                            _space_info[id].new_top_addr());
+    summarize_in_place(id, dense_prefix_end);
   }
 
   // Summarize the remaining spaces in the young gen.  The initial target space
@@ -1346,7 +1466,7 @@ bool PSParallelCompact::invoke_no_policy(bool maximum_heap_compaction) {
 
     ref_processor()->start_discovery(maximum_heap_compaction);
 
-    ClassUnloadingContext ctx(1 /* num_nmethod_unlink_workers */,
+    ClassUnloadingContext ctx(ParallelScavengeHeap::heap()->workers().active_workers(),
                               false /* unregister_nmethods_during_purge */,
                               false /* lock_nmethod_free_separately */);
 
@@ -1656,8 +1776,12 @@ void PSParallelCompact::marking_phase(ParallelOldTracer *gc_tracer) {
       // Follow system dictionary roots and unload classes.
       unloading_occurred = SystemDictionary::do_unloading(&_gc_timer);
 
-      // Unload nmethods.
-      CodeCache::do_unloading(unloading_occurred);
+      // Unload nmethods, prune dead klasses from subklass/sibling/implementor
+      // lists and clean JVMCI metadata handles.
+      GCTraceTime(Debug, gc, phases) t("Parallel Cleaning", gc_timer());
+      WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+      ParallelCleaningTask task(workers.active_workers(), unloading_occurred);
+      workers.run_task(&task);
     }
 
     {
@@ -1673,12 +1797,6 @@ void PSParallelCompact::marking_phase(ParallelOldTracer *gc_tracer) {
       GCTraceTime(Debug, gc, phases) t("Free Code Blobs", gc_timer());
       ctx->free_nmethods();
     }
-
-    // Prune dead klasses from subklass/sibling/implementor lists.
-    Klass::clean_weak_klass_links(unloading_occurred);
-
-    // Clean JVMCI metadata handles.
-    JVMCI_ONLY(JVMCI::do_unloading(unloading_occurred));
   }
 
   {
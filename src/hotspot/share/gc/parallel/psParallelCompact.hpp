@@ -457,6 +457,14 @@ class ParallelCompactData
 #endif  // #ifdef ASSERT
 
 private:
+  friend class PSSummarizeTask;
+
+  // Set the destination_count of the non-empty region region_idx whose data
+  // is copied to dest_addr, and the source_region of the destination regions
+  // it is the first source of.  The destination regions are only written by
+  // the region whose data covers their start.
+  void summarize_region(SplitInfo& split_info, size_t region_idx, HeapWord* dest_addr);
+
   bool initialize_block_data();
   bool initialize_region_data(size_t heap_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
@@ -957,6 +965,9 @@ class PSParallelCompact : AllStatic {
   static void fill_dense_prefix_end(SpaceId id);
 
   static void summary_phase(bool maximum_compaction);
+  // Summarize the space id from source_beg to its top, compacting it into
+  // itself starting at source_beg.  Uses the parallel workers for large spaces.
+  static void summarize_in_place(SpaceId id, HeapWord* source_beg);
 
   // Adjust addresses in roots.  Does not adjust addresses in heap.
   static void adjust_roots();
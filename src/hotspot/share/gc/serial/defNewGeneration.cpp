@@ -47,12 +47,14 @@
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/weakProcessor.hpp"
 #include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/instanceRefKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/threads.hpp"
 #include "utilities/align.hpp"
@@ -361,6 +363,58 @@ void DefNewGeneration::compute_space_boundaries(uintx minimum_eden_size,
   to()->initialize(toMR, clear_space, mangle_space);
 }
 
+void DefNewGeneration::log_numa_placement() const {
+  LogTarget(Debug, gc, heap) lt;
+  if (!UseNUMA || !lt.is_enabled()) {
+    return;
+  }
+
+  const size_t max_samples = 256;
+  const void* addresses[max_samples];
+  int node_ids[max_samples];
+
+  const size_t page_size = os::vm_page_size();
+  const size_t num_pages = eden()->capacity() / page_size;
+  const size_t num_samples = MIN2(max_samples, num_pages);
+  if (num_samples == 0) {
+    return;
+  }
+  const size_t stride = num_pages / num_samples * page_size;
+  for (size_t i = 0; i < num_samples; i++) {
+    addresses[i] = (char*)eden()->bottom() + i * stride;
+  }
+  if (!os::numa_get_group_ids_for_range(addresses, node_ids, num_samples)) {
+    return;
+  }
+
+  ResourceMark rm;
+  const size_t max_nodes = os::numa_get_groups_num();
+  uint* nodes = NEW_RESOURCE_ARRAY(uint, max_nodes);
+  const size_t num_nodes = os::numa_get_leaf_groups(nodes, max_nodes);
+  size_t* counts = NEW_RESOURCE_ARRAY(size_t, num_nodes);
+  for (size_t n = 0; n < num_nodes; n++) {
+    counts[n] = 0;
+  }
+  // Pages that are not resident yet report a negative id.
+  size_t not_resident = num_samples;
+  for (size_t i = 0; i < num_samples; i++) {
+    for (size_t n = 0; n < num_nodes; n++) {
+      if (node_ids[i] >= 0 && (uint)node_ids[i] == nodes[n]) {
+        counts[n]++;
+        not_resident--;
+        break;
+      }
+    }
+  }
+
+  LogStream ls(lt);
+  ls.print("Eden NUMA placement of " SIZE_FORMAT " sampled pages:", num_samples);
+  for (size_t n = 0; n < num_nodes; n++) {
+    ls.print(" node %u: %.1f%%", nodes[n], percent_of(counts[n], num_samples));
+  }
+  ls.print_cr(" other: %.1f%%", percent_of(not_resident, num_samples));
+}
+
 void DefNewGeneration::swap_spaces() {
   ContiguousSpace* s = from();
   _from_space        = to();
@@ -921,6 +975,10 @@ bool DefNewGeneration::collection_attempt_is_safe() {
 void DefNewGeneration::gc_epilogue(bool full) {
   DEBUG_ONLY(static bool seen_incremental_collection_failed = false;)
 
+  if (!full) {
+    log_numa_placement();
+  }
+
   assert(!GCLocker::is_active(), "We should not be executing here");
   // Check if the heap is approaching full after a collection has
   // been done.  Generally the young generation is empty at
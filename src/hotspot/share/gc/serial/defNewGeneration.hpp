@@ -297,6 +297,9 @@ class DefNewGeneration: public Generation {
 
   size_t calculate_thread_increase_size(int threads_count) const;
 
+  // Log the placement of sampled eden pages on the NUMA nodes.
+  void log_numa_placement() const;
+
 
   // Scavenge support
   void swap_spaces();
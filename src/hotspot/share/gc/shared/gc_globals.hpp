@@ -303,6 +303,11 @@
   product(int, ActiveProcessorCount, -1,                                    \
           "Specify the CPU count the VM should use and report as active")   \
                                                                             \
+  product(bool, LimitThreadsToActiveProcessors, false, EXPERIMENTAL,        \
+          "Limit the number of active GC worker threads and dynamically "   \
+          "started compiler threads to the current active processor "       \
+          "count, which may change at runtime in a container")              \
+                                                                            \
   develop(uintx, MaxVirtMemFraction, 2,                                     \
           "Maximum fraction (1/n) of virtual memory used for ergonomically "\
           "determining maximum heap size")                                  \
@@ -625,6 +630,12 @@
           "during parallel gc")                                             \
           range(0, 8 * 1024)                                                \
                                                                             \
+  product(uint, TaskQueueStealBatchSize, 1, EXPERIMENTAL,                   \
+          "Maximum number of tasks a worker steals from another task "      \
+          "queue in one operation; up to half of the victim's tasks are "   \
+          "taken. 1 steals single tasks")                                   \
+          range(1, 64)                                                      \
+                                                                            \
   product(uint, GCCardSizeInBytes, 512,                                     \
           "Card table entry size (in bytes) for card based collectors")     \
           range(128, NOT_LP64(512) LP64_ONLY(1024))                         \
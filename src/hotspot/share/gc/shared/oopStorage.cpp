@@ -507,6 +507,33 @@ size_t OopStorage::allocate(oop** ptrs, size_t size) {
   return limit;                 // Return number allocated.
 }
 
+OopStorageAllocationCache::OopStorageAllocationCache(OopStorage* storage) :
+  _storage(storage),
+  _count(0)
+{}
+
+OopStorageAllocationCache::~OopStorageAllocationCache() {
+  flush();
+}
+
+bool OopStorageAllocationCache::refill() {
+  assert(_count == 0, "precondition");
+  _count = _storage->allocate(_entries, ARRAY_SIZE(_entries));
+  return _count != 0;
+}
+
+oop* OopStorageAllocationCache::allocate() {
+  if ((_count == 0) && !refill()) return nullptr;
+  return _entries[--_count];
+}
+
+void OopStorageAllocationCache::flush() {
+  if (_count > 0) {
+    _storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
 void OopStorage::log_block_transition(Block* block, const char* new_state) const {
   log_trace(oopstorage, blocks)("%s: block %s " PTR_FORMAT, name(), new_state, p2i(block));
 }
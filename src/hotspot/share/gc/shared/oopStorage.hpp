@@ -26,6 +26,7 @@
 #define SHARE_GC_SHARED_OOPSTORAGE_HPP
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "oops/oop.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -264,8 +265,11 @@ class OopStorage : public CHeapObjBase {
   Mutex* _active_mutex;
   NumDeadCallback _num_dead_callback;
 
-  // Volatile for racy unlocked accesses.
+  // Volatile for racy unlocked accesses.  Every release updates this from
+  // an arbitrary thread, so keep it off the lines read by allocation.
+  DEFINE_PAD_MINUS_SIZE(0, DEFAULT_PADDING_SIZE, 0);
   volatile size_t _allocation_count;
+  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(volatile size_t));
 
   // Protection for _active_array.
   mutable SingleWriterSynchronizer _protect_active;
@@ -322,4 +326,39 @@ class OopStorage : public CHeapObjBase {
   template<typename F> static SkipNullFn<F> skip_null_fn(F f);
 };
 
+// A small cache of pre-allocated entries from a single OopStorage, refilled
+// using the bulk allocation API.  Intended to be owned by a single thread,
+// e.g. embedded in a thread-local structure, so that most allocations avoid
+// the storage's _allocation_mutex.  Cached entries are allocated from the
+// storage's point of view, but always contain null until handed out.  Any
+// remaining entries are released back to the storage by flush() and by the
+// destructor.
+class OopStorageAllocationCache : public CHeapObj<mtGC> {
+  OopStorage* _storage;
+  size_t _count;
+  oop* _entries[OopStorage::bulk_allocate_limit];
+
+  NONCOPYABLE(OopStorageAllocationCache);
+
+  bool refill();
+
+public:
+  explicit OopStorageAllocationCache(OopStorage* storage);
+  ~OopStorageAllocationCache();
+
+  OopStorage* storage() const { return _storage; }
+
+  // Number of pre-allocated entries currently held by the cache.
+  size_t count() const { return _count; }
+
+  // Returns a cached entry, refilling the cache from the storage if it is
+  // empty.  Only locks the storage's _allocation_mutex when refilling.
+  // Returns null if the refill failed.
+  // postcondition: result == nullptr or *result == nullptr.
+  oop* allocate();
+
+  // Release all cached entries back to the storage.  No locking.
+  void flush();
+};
+
 #endif // SHARE_GC_SHARED_OOPSTORAGE_HPP
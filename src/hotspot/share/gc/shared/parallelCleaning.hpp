@@ -73,4 +73,37 @@ class KlassCleaningTask : public StackObj {
   void work();
 };
 
+#if INCLUDE_JVMCI
+class JVMCICleaningTask : public StackObj {
+  volatile bool _cleaning_claimed;
+
+public:
+  JVMCICleaningTask();
+  // Clean JVMCI metadata handles.
+  void work(bool unloading_occurred);
+
+private:
+  bool claim_cleaning_task();
+};
+#endif
+
+// Do cleanup of some weakly held data in the same parallel task.
+// Assumes a non-moving context.
+class ParallelCleaningTask : public WorkerTask {
+private:
+  bool                    _unloading_occurred;
+  CodeCacheUnloadingTask  _code_cache_task;
+#if INCLUDE_JVMCI
+  JVMCICleaningTask       _jvmci_cleaning_task;
+#endif
+  KlassCleaningTask       _klass_cleaning_task;
+
+public:
+  // The constructor is run in the VMThread.
+  ParallelCleaningTask(uint num_workers,
+                       bool unloading_occurred);
+
+  void work(uint worker_id);
+};
+
 #endif // SHARE_GC_SHARED_PARALLELCLEANING_HPP
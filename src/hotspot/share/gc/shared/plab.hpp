@@ -103,6 +103,7 @@ class PLAB: public CHeapObj<mtGC> {
   // unallocated space.
   size_t word_sz() { return _word_sz; }
 
+  size_t allocated() { return _allocated; }
   size_t waste() { return _wasted; }
   size_t undo_waste() { return _undo_wasted; }
 
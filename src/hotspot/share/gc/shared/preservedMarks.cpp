@@ -55,15 +55,6 @@ void PreservedMarks::adjust_during_full_gc() {
   }
 }
 
-void PreservedMarks::restore_and_increment(volatile size_t* const total_size_addr) {
-  const size_t stack_size = size();
-  restore();
-  // Only do the atomic add if the size is > 0.
-  if (stack_size > 0) {
-    Atomic::add(total_size_addr, stack_size);
-  }
-}
-
 #ifndef PRODUCT
 void PreservedMarks::assert_empty() {
   assert(_stack.is_empty(), "stack expected to be empty, size = " SIZE_FORMAT,
@@ -90,38 +81,78 @@ void PreservedMarksSet::init(uint num) {
   assert_empty();
 }
 
+// Restores the preserved marks of all stacks in parallel. Work is distributed
+// at the granularity of stack segments so that a single large stack, e.g. of
+// the one worker that had most evacuation failures, does not serialize the
+// task. The stack segments are released in bulk after all marks are restored.
 class RestorePreservedMarksTask : public WorkerTask {
+  struct Chunk {
+    PreservedMark* _marks;
+    size_t _num_marks;
+  };
+
   PreservedMarksSet* const _preserved_marks_set;
-  SequentialSubTasksDone _sub_tasks;
+  Chunk* _chunks;
+  size_t _num_chunks;
+  volatile size_t _next_chunk;
   volatile size_t _total_size;
 #ifdef ASSERT
   size_t _total_size_before;
 #endif // ASSERT
 
+  void restore_chunk(const Chunk& chunk) {
+    for (size_t i = 0; i < chunk._num_marks; i++) {
+      chunk._marks[i].set_mark();
+    }
+  }
+
 public:
   void work(uint worker_id) override {
-    uint task_id = 0;
-    while (_sub_tasks.try_claim_task(task_id)) {
-      _preserved_marks_set->get(task_id)->restore_and_increment(&_total_size);
+    size_t restored = 0;
+    size_t chunk_idx;
+    while ((chunk_idx = Atomic::fetch_then_add(&_next_chunk, (size_t)1)) < _num_chunks) {
+      restore_chunk(_chunks[chunk_idx]);
+      restored += _chunks[chunk_idx]._num_marks;
+    }
+    // Only do the atomic add if something has been restored.
+    if (restored > 0) {
+      Atomic::add(&_total_size, restored);
     }
   }
 
   RestorePreservedMarksTask(PreservedMarksSet* preserved_marks_set)
     : WorkerTask("Restore Preserved Marks"),
       _preserved_marks_set(preserved_marks_set),
-      _sub_tasks(preserved_marks_set->num()),
+      _chunks(nullptr),
+      _num_chunks(0),
+      _next_chunk(0),
       _total_size(0)
       DEBUG_ONLY(COMMA _total_size_before(0)) {
+    const size_t max_chunks = _preserved_marks_set->num_segments();
 #ifdef ASSERT
-    // This is to make sure the total_size we'll calculate below is correct.
     for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
       _total_size_before += _preserved_marks_set->get(i)->size();
     }
 #endif // ASSERT
+    if (max_chunks == 0) {
+      return;
+    }
+
+    _chunks = NEW_C_HEAP_ARRAY(Chunk, max_chunks, mtGC);
+    for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+      _preserved_marks_set->get(i)->iterate_segments([&] (PreservedMark* marks, size_t num_marks) {
+        assert(_num_chunks < max_chunks, "must be");
+        _chunks[_num_chunks++] = { marks, num_marks };
+      });
+    }
   }
 
   ~RestorePreservedMarksTask() {
     assert(_total_size == _total_size_before, "total_size = %zu before = %zu", _total_size, _total_size_before);
+    for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+      _preserved_marks_set->get(i)->clear();
+    }
+    FREE_C_HEAP_ARRAY(Chunk, _chunks);
     size_t mem_size = _total_size * (sizeof(oop) + sizeof(markWord));
     log_trace(gc)("Restored %zu marks, occupying %zu %s", _total_size,
                                                           byte_size_in_proper_unit(mem_size),
@@ -146,6 +177,15 @@ WorkerTask* PreservedMarksSet::create_task() {
   return new RestorePreservedMarksTask(this);
 }
 
+size_t PreservedMarksSet::num_segments() const {
+  size_t result = 0;
+  for (uint i = 0; i < _num; ++i) {
+    PreservedMarks* stack = get(i);
+    result += (stack->size() + stack->segment_size() - 1) / stack->segment_size();
+  }
+  return result;
+}
+
 void PreservedMarksSet::reclaim() {
   assert_empty();
 
@@ -57,6 +57,7 @@ class PreservedMarks {
 
 public:
   size_t size() const { return _stack.size(); }
+  size_t segment_size() const { return _stack.segment_size(); }
   inline void push_if_necessary(oop obj, markWord m);
   inline void push_always(oop obj, markWord m);
   // Iterate over the stack, restore all preserved marks, and
@@ -71,7 +72,13 @@ class PreservedMarks {
   // to their forwarding location stored in the mark.
   void adjust_during_full_gc();
 
-  void restore_and_increment(volatile size_t* const _total_size_addr);
+  // Apply f(PreservedMark* marks, size_t num_marks) to the segments of the stack.
+  template <typename Function>
+  inline void iterate_segments(Function f);
+
+  // Reclaim the memory taken up by the stack segments without restoring
+  // the preserved marks.
+  void clear() { _stack.clear(true /* clear_cache */); }
 
   // Assert the stack is empty and has no cached segments.
   void assert_empty() PRODUCT_RETURN;
@@ -116,6 +123,10 @@ class PreservedMarksSet : public CHeapObj<mtGC> {
 
   WorkerTask* create_task();
 
+  // Number of stack segments holding preserved marks, the units of work of
+  // the task returned by create_task().
+  size_t num_segments() const;
+
   // Reclaim stack array.
   void reclaim();
 
@@ -56,6 +56,16 @@ inline PreservedMarks::PreservedMarks()
              // cache size to 0.
              0 /* max_cache_size */) { }
 
+template <typename Function>
+inline void PreservedMarks::iterate_segments(Function f) {
+  StackIterator<PreservedMark, mtGC> iter(_stack);
+  while (!iter.is_empty()) {
+    size_t num_marks;
+    PreservedMark* marks = iter.next_segment(&num_marks);
+    f(marks, num_marks);
+  }
+}
+
 void PreservedMark::set_mark() const {
   _o->set_mark(_m);
 }
@@ -30,6 +30,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/ticks.hpp"
 
 PretouchTask::PretouchTask(const char* task_name,
                            char* start_address,
@@ -75,6 +76,8 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
     return;
   }
 
+  Ticks start = Ticks::now();
+
   if (pretouch_workers != nullptr) {
     size_t num_chunks = ((total_bytes - 1) / chunk_size) + 1;
 
@@ -88,4 +91,7 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
                         task.name(), total_bytes);
     task.work(0);
   }
+
+  log_debug(gc, heap)("%s pre-touched " SIZE_FORMAT "B in %.3fms",
+                      task.name(), total_bytes, (Ticks::now() - start).seconds() * MILLIUNITS);
 }
@@ -61,7 +61,21 @@ void StringDedup::Processor::initialize_storage() {
   _storage_for_processing = new StorageUse(_storages[1]);
 }
 
-StringDedup::Processor::Processor() : _thread(nullptr) {}
+StringDedup::Processor::Processor() :
+  _thread(nullptr),
+  _num_threads(StringDeduplicationThreads),
+  _process_epoch(0),
+  _active_helpers(0),
+  _par_state(nullptr),
+  _helper_stats(nullptr)
+{
+  if (_num_threads > 1) {
+    _helper_stats = NEW_C_HEAP_ARRAY(Stat, _num_threads, mtStringDedup);
+    for (uint i = 0; i < _num_threads; ++i) {
+      ::new (&_helper_stats[i]) Stat();
+    }
+  }
+}
 
 void StringDedup::Processor::initialize() {
   _processor = new Processor();
@@ -117,8 +131,20 @@ void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
   }
 }
 
+void StringDedup::Processor::grow_table_for(size_t expected_new) const {
+  if (Table::grow_start_if_needed(expected_new)) {
+    do {
+      yield();
+    } while (Table::cleanup_step());
+    Table::cleanup_end();
+  }
+}
+
 class StringDedup::Processor::ProcessRequest final : public OopClosure {
   OopStorage* _storage;
+  JavaThread* _thread;
+  Stat* _stat;
+  bool _allow_grow;
   size_t _release_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
 
@@ -133,8 +159,11 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   }
 
 public:
-  ProcessRequest(OopStorage* storage) :
+  ProcessRequest(OopStorage* storage, JavaThread* thread, Stat* stat, bool allow_grow) :
     _storage(storage),
+    _thread(thread),
+    _stat(stat),
+    _allow_grow(allow_grow),
     _release_index(0),
     _bulk_release()
   {}
@@ -146,20 +175,26 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   virtual void do_oop(narrowOop*) { ShouldNotReachHere(); }
 
   virtual void do_oop(oop* ref) {
-    _processor->yield();
+    {
+      // Yield if requested.
+      ThreadBlockInVM tbivm(_thread);
+    }
     oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
     release_ref(ref);
     // Dedup java_string, after checking for various reasons to skip it.
     if (java_string == nullptr) {
       // String became unreachable before we got a chance to process it.
-      _cur_stat.inc_skipped_dead();
+      _stat->inc_skipped_dead();
     } else if (java_lang_String::value(java_string) == nullptr) {
       // Request during String construction, before its value array has
       // been initialized.
-      _cur_stat.inc_skipped_incomplete();
+      _stat->inc_skipped_incomplete();
     } else {
-      Table::deduplicate(java_string);
-      if (Table::is_grow_needed()) {
+      Table::deduplicate(java_string, _stat);
+      // Growing the table while processing is only possible when there are
+      // no helpers.  Otherwise growth is left to the cleanup that follows
+      // processing.
+      if (_allow_grow && Table::is_grow_needed()) {
         _cur_stat.report_process_pause();
         _processor->cleanup_table(true /* grow_only */, false /* force */);
         _cur_stat.report_process_resume();
@@ -168,14 +203,98 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   }
 };
 
-void StringDedup::Processor::process_requests() const {
+void StringDedup::Processor::start_helpers(ParState* par_state) {
+  assert(Thread::current() == _thread, "precondition");
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  assert(_active_helpers == 0, "helpers still active");
+  _par_state = par_state;
+  _active_helpers = _num_threads - 1;
+  ++_process_epoch;
+  ml.notify_all();
+}
+
+void StringDedup::Processor::wait_for_helpers() {
+  assert(Thread::current() == _thread, "precondition");
+  {
+    ThreadBlockInVM tbivm(_thread);
+    MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+    while (_active_helpers > 0) {
+      ml.wait();
+    }
+    _par_state = nullptr;
+  }
+  for (uint i = 0; i < _num_threads; ++i) {
+    _cur_stat.add_counters(&_helper_stats[i]);
+    if (log_is_enabled(Debug, stringdedup)) {
+      _helper_stats[i].log_process_throughput(i);
+    }
+    _helper_stats[i] = Stat{};
+  }
+}
+
+void StringDedup::Processor::process_requests() {
+  OopStorage* storage = _storage_for_processing->storage();
+  if (_num_threads > 1) {
+    // Helpers can't grow the table while they run, so make room for the
+    // whole batch before starting them.  This overestimates when requests
+    // are for known strings; a later cleanup shrinks the table again.
+    grow_table_for(storage->allocation_count());
+  }
   _cur_stat.report_process_start();
-  OopStorage::ParState<true, false> par_state{_storage_for_processing->storage(), 1};
-  ProcessRequest processor{_storage_for_processing->storage()};
-  par_state.oops_do(&processor);
+  ParState par_state{storage, _num_threads};
+  if (_num_threads > 1) {
+    start_helpers(&par_state);
+  }
+  if (_num_threads == 1) {
+    ProcessRequest processor{storage, _thread, &_cur_stat, true /* allow_grow */};
+    par_state.oops_do(&processor);
+  } else {
+    Stat* stat = &_helper_stats[0];
+    stat->report_process_start();
+    {
+      ProcessRequest processor{storage, _thread, stat, false /* allow_grow */};
+      par_state.oops_do(&processor);
+    }
+    stat->report_process_end();
+    wait_for_helpers();
+  }
   _cur_stat.report_process_end();
 }
 
+void StringDedup::Processor::run_helper(JavaThread* thread, uint worker_id) {
+  assert(thread == Thread::current(), "precondition");
+  assert(0 < worker_id && worker_id < _num_threads, "invalid worker id %u", worker_id);
+  log_debug(stringdedup)("Starting string deduplication helper thread %u", worker_id);
+  size_t seen_epoch = 0;
+  while (true) {
+    ParState* par_state;
+    {
+      ThreadBlockInVM tbivm(thread);
+      MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+      while (_process_epoch == seen_epoch) {
+        ml.wait();
+      }
+      seen_epoch = _process_epoch;
+      par_state = _par_state;
+    }
+    assert(par_state != nullptr, "invariant");
+    Stat* stat = &_helper_stats[worker_id];
+    stat->report_process_start();
+    {
+      ProcessRequest processor{_storage_for_processing->storage(), thread, stat, false /* allow_grow */};
+      par_state->oops_do(&processor);
+    }
+    stat->report_process_end();
+    {
+      MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+      assert(_active_helpers > 0, "invariant");
+      if (--_active_helpers == 0) {
+        ml.notify_all();
+      }
+    }
+  }
+}
+
 void StringDedup::Processor::run(JavaThread* thread) {
   assert(thread == Thread::current(), "precondition");
   _thread = thread;
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
 #define SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
 
+#include "gc/shared/oopStorageParState.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/macros.hpp"
@@ -41,6 +42,14 @@ class OopStorage;
 // requests is performed in incremental chunks.  The Table provides
 // incremental operations for resizing and for removing dead entries, so
 // safepoint checks can be performed between steps in those operations.
+//
+// With StringDeduplicationThreads > 1, the primary deduplication thread is
+// assisted by helper threads when processing requests.  The primary thread
+// swaps the request storages and publishes a parallel iteration state for
+// the processing storage; all threads then claim and process blocks of
+// requests from that state.  The primary thread waits for the helpers to
+// complete before performing any table cleanup, so the table is never
+// resized while requests are being processed in parallel.
 class StringDedup::Processor : public CHeapObj<mtGC> {
   Processor();
   ~Processor() = default;
@@ -51,8 +60,20 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   static StorageUse* volatile _storage_for_requests;
   static StorageUse* _storage_for_processing;
 
+  using ParState = OopStorage::ParState<true /* concurrent */, false /* is_const */>;
+
   JavaThread* _thread;
 
+  // Coordination with helper threads, protected by StringDedup_lock.
+  uint _num_threads;
+  size_t _process_epoch;
+  uint _active_helpers;
+  ParState* _par_state;
+
+  // Per-thread statistics for the current processing phase, indexed by
+  // worker id, with the primary thread at index 0.  Only used with helpers.
+  Stat* _helper_stats;
+
   // Wait until there are requests to be processed.  The storage for requests
   // and storage for processing are swapped; the former requests storage
   // becomes the current processing storage, and vice versa.
@@ -63,8 +84,11 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   void yield() const;
 
   class ProcessRequest;
-  void process_requests() const;
+  void process_requests();
+  void start_helpers(ParState* par_state);
+  void wait_for_helpers();
   void cleanup_table(bool grow_only, bool force) const;
+  void grow_table_for(size_t expected_new) const;
 
   void log_statistics();
 
@@ -74,9 +98,17 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   static void initialize_storage();
   static StorageUse* storage_for_requests();
 
+  // Number of threads processing requests, including the primary thread.
+  uint num_threads() const { return _num_threads; }
+
   // Use thread as the deduplication thread.
   // precondition: thread == Thread::current()
   void run(JavaThread* thread);
+
+  // Use thread as a helper for processing requests.
+  // precondition: thread == Thread::current()
+  // precondition: 0 < worker_id < num_threads()
+  void run_helper(JavaThread* thread, uint worker_id);
 };
 
 #endif // SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
@@ -55,6 +55,20 @@ StringDedup::Stat::Stat() :
 {}
 
 void StringDedup::Stat::add(const Stat* const stat) {
+  add_counters(stat);
+  _active              += stat->_active;
+  _idle                += stat->_idle;
+  _process             += stat->_process;
+  _resize_table        += stat->_resize_table;
+  _cleanup_table       += stat->_cleanup_table;
+  _active_elapsed      += stat->_active_elapsed;
+  _idle_elapsed        += stat->_idle_elapsed;
+  _process_elapsed     += stat->_process_elapsed;
+  _resize_table_elapsed += stat->_resize_table_elapsed;
+  _cleanup_table_elapsed += stat->_cleanup_table_elapsed;
+}
+
+void StringDedup::Stat::add_counters(const Stat* const stat) {
   _inspected           += stat->_inspected;
   _known               += stat->_known;
   _known_shared        += stat->_known_shared;
@@ -67,16 +81,6 @@ void StringDedup::Stat::add(const Stat* const stat) {
   _skipped_dead        += stat->_skipped_dead;
   _skipped_incomplete  += stat->_skipped_incomplete;
   _skipped_shared      += stat->_skipped_shared;
-  _active              += stat->_active;
-  _idle                += stat->_idle;
-  _process             += stat->_process;
-  _resize_table        += stat->_resize_table;
-  _cleanup_table       += stat->_cleanup_table;
-  _active_elapsed      += stat->_active_elapsed;
-  _idle_elapsed        += stat->_idle_elapsed;
-  _process_elapsed     += stat->_process_elapsed;
-  _resize_table_elapsed += stat->_resize_table_elapsed;
-  _cleanup_table_elapsed += stat->_cleanup_table_elapsed;
 }
 
 // Support for log output formatting
@@ -230,3 +234,13 @@ void StringDedup::Stat::log_statistics(bool total) const {
   log_debug(stringdedup)("    Skipped: %zu (dead), %zu (incomplete), %zu (shared)",
                          _skipped_dead, _skipped_incomplete, _skipped_shared);
 }
+
+void StringDedup::Stat::log_process_throughput(uint worker_id) const {
+  double elapsed_ms = strdedup_elapsed_param_ms(_process_elapsed);
+  double rate = (elapsed_ms > 0.0) ? (_inspected / elapsed_ms) : 0.0;
+  log_debug(stringdedup)("  Thread %u: %zu inspected, %zu skipped in "
+                         STRDEDUP_ELAPSED_FORMAT_MS " (%.1f/ms)",
+                         worker_id, _inspected,
+                         _skipped_dead + _skipped_incomplete + _skipped_shared,
+                         elapsed_ms, rate);
+}
@@ -32,7 +32,10 @@
 // Deduplication statistics.
 //
 // Operation counters are updated when deduplicating a string.
-// Phase timing information is collected by the processing thread.
+// Phase timing information is collected by the processing thread.  With
+// multiple processing threads, each thread records its operation counters
+// and process time in its own Stat, and the counters are merged into the
+// current Stat by the primary processing thread.
 class StringDedup::Stat {
 private:
   // Counters
@@ -148,7 +151,12 @@ class StringDedup::Stat {
   void report_active_end();
 
   void add(const Stat* const stat);
+  // Add only the operation counters of stat.
+  void add_counters(const Stat* const stat);
   void log_statistics(bool total) const;
+  // Log the number of strings inspected by a processing thread, and the
+  // rate at which they were processed.
+  void log_process_throughput(uint worker_id) const;
 
   static void log_summary(const Stat* last_stat, const Stat* total_stat);
 };
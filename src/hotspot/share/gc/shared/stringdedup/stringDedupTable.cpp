@@ -35,6 +35,7 @@
 #include "gc/shared/stringdedup/stringDedupStat.hpp"
 #include "gc/shared/stringdedup/stringDedupTable.hpp"
 #include "memory/allocation.hpp"
+#include "memory/padded.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -42,11 +43,13 @@
 #include "oops/oopsHierarchy.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "oops/weakHandle.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/spinYield.hpp"
 
 //////////////////////////////////////////////////////////////////////////////
 // StringDedup::Table::Bucket
@@ -269,6 +272,41 @@ void StringDedup::Table::num_dead_callback(size_t num_dead) {
   ml.notify_all();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// StringDedup::Table::BucketLocker
+//
+// With multiple processing threads, deduplicate locks the bucket being
+// searched and possibly updated.  Buckets are mapped onto a fixed set of
+// striped spin locks.  The critical sections are short and never block for
+// a safepoint, so spinning is adequate.  Without multiple processing threads
+// there are no locks and this does nothing.
+
+class StringDedup::Table::BucketLocker {
+  volatile int* _lock;
+
+  NONCOPYABLE(BucketLocker);
+
+public:
+  static const size_t number_of_locks = 256;
+
+  explicit BucketLocker(size_t bucket_index) :
+    _lock(_bucket_locks == nullptr ? nullptr : &_bucket_locks[bucket_index % number_of_locks])
+  {
+    if (_lock != nullptr) {
+      SpinYield spinner;
+      while ((Atomic::load(_lock) != 0) || (Atomic::cmpxchg(_lock, 0, 1) != 0)) {
+        spinner.wait();
+      }
+    }
+  }
+
+  ~BucketLocker() {
+    if (_lock != nullptr) {
+      Atomic::release_store(_lock, 0);
+    }
+  }
+};
+
 //////////////////////////////////////////////////////////////////////////////
 // StringDedup::Table::CleanupState
 
@@ -422,6 +460,7 @@ size_t StringDedup::Table::_number_of_entries = 0;
 size_t StringDedup::Table::_grow_threshold;
 StringDedup::Table::CleanupState* StringDedup::Table::_cleanup_state = nullptr;
 bool StringDedup::Table::_need_bucket_shrinking = false;
+volatile int* StringDedup::Table::_bucket_locks = nullptr;
 volatile size_t StringDedup::Table::_dead_count = 0;
 volatile StringDedup::Table::DeadState StringDedup::Table::_dead_state = DeadState::good;
 
@@ -436,6 +475,9 @@ void StringDedup::Table::initialize() {
   _number_of_buckets = num_buckets;
   _grow_threshold = Config::grow_threshold(num_buckets);
   _table_storage->register_num_dead_callback(num_dead_callback);
+  if (StringDeduplicationThreads > 1) {
+    _bucket_locks = PaddedPrimitiveArray<volatile int, mtStringDedup>::create_unfreeable(BucketLocker::number_of_locks);
+  }
 }
 
 StringDedup::Table::Bucket*
@@ -472,7 +514,8 @@ size_t StringDedup::Table::hash_to_index(uint hash_code) {
 
 void StringDedup::Table::add(TableValue tv, uint hash_code) {
   _buckets[hash_to_index(hash_code)].add(hash_code, tv);
-  ++_number_of_entries;
+  // Atomic because of possibly concurrent deduplicate calls.
+  Atomic::inc(&_number_of_entries);
 }
 
 bool StringDedup::Table::is_dead_count_good_acquire() {
@@ -501,9 +544,9 @@ StringDedup::Table::find(typeArrayOop obj, uint hash_code) {
   return _buckets[hash_to_index(hash_code)].find(obj, hash_code);
 }
 
-void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
+void StringDedup::Table::install(typeArrayOop obj, uint hash_code, Stat* stat) {
   add(TableValue(_table_storage, obj), hash_code);
-  _cur_stat.inc_new(obj->size() * HeapWordSize);
+  stat->inc_new(obj->size() * HeapWordSize);
 }
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -514,7 +557,7 @@ void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
 // of the string we're deduplicating.  GC requests can provide us with
 // access to a String that is incompletely constructed; the value could be
 // set before the coder.
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   typeArrayOop value = java_lang_String::value(java_string);
   assert(value != nullptr, "precondition");
   assert(TypeArrayKlass::cast(value->klass())->element_type() == T_BYTE, "precondition");
@@ -534,7 +577,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
     // table key, so not actually a match to value.
     if ((found != nullptr) &&
         !java_lang_String::is_latin1(found) &&
-        try_deduplicate_found_shared(java_string, found)) {
+        try_deduplicate_found_shared(java_string, found, stat)) {
       return true;
     }
     // That didn't work.  Try as compact latin1.
@@ -547,7 +590,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   ResourceMark rm(Thread::current());
   jchar* chars = NEW_RESOURCE_ARRAY_RETURN_NULL(jchar, length);
   if (chars == nullptr) {
-    _cur_stat.inc_skipped_shared();
+    stat->inc_skipped_shared();
     return true;
   }
   for (int i = 0; i < length; ++i) {
@@ -556,11 +599,11 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   oop found = StringTable::lookup_shared(chars, length);
   if (found == nullptr) return false;
   assert(java_lang_String::is_latin1(found), "invariant");
-  return try_deduplicate_found_shared(java_string, found);
+  return try_deduplicate_found_shared(java_string, found, stat);
 }
 
-bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found) {
-  _cur_stat.inc_known_shared();
+bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat) {
+  stat->inc_known_shared();
   typeArrayOop found_value = java_lang_String::value(found);
   if (found_value == java_lang_String::value(java_string)) {
     // String's value already matches what's in the table.
@@ -571,7 +614,7 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
     // shared string.  But if they have different coders but happen to have
     // the same sequence of bytes in their value arrays, then java_string
     // could have been interned and marked deduplication-forbidden.
-    _cur_stat.inc_deduped(found_value->size() * HeapWordSize);
+    stat->inc_deduped(found_value->size() * HeapWordSize);
     return true;
   } else {
     // Must be a mismatch between java_string and found string encodings,
@@ -585,13 +628,13 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
 
 #else // if !INCLUDE_CDS_JAVA_HEAP
 
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   ShouldNotReachHere();         // Call is guarded.
   return false;
 }
 
 // Undefined because unreferenced.
-// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found);
+// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
 
 #endif // INCLUDE_CDS_JAVA_HEAP
 
@@ -607,27 +650,28 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
   }
 }
 
-void StringDedup::Table::deduplicate(oop java_string) {
+void StringDedup::Table::deduplicate(oop java_string, Stat* stat) {
   assert(java_lang_String::is_instance(java_string), "precondition");
-  _cur_stat.inc_inspected();
+  stat->inc_inspected();
   if ((StringTable::shared_entry_count() > 0) &&
-      try_deduplicate_shared(java_string)) {
+      try_deduplicate_shared(java_string, stat)) {
     return;                     // Done if deduplicated against shared StringTable.
   }
   typeArrayOop value = java_lang_String::value(java_string);
   uint hash_code = compute_hash(value);
+  BucketLocker bl(hash_to_index(hash_code));
   TableValue tv = find(value, hash_code);
   if (tv.is_empty()) {
     // Not in table.  Create a new table entry.
-    install(value, hash_code);
+    install(value, hash_code, stat);
   } else {
-    _cur_stat.inc_known();
+    stat->inc_known();
     typeArrayOop found = cast_from_oop<typeArrayOop>(tv.resolve());
     assert(found != nullptr, "invariant");
     // Deduplicate if value array differs from what's in the table.
     if (found != value) {
       if (deduplicate_if_permitted(java_string, found)) {
-        _cur_stat.inc_deduped(found->size() * HeapWordSize);
+        stat->inc_deduped(found->size() * HeapWordSize);
       } else {
         // If string marked deduplication_forbidden then we can't update its
         // value.  Instead, replace the array in the table with the new one,
@@ -635,7 +679,7 @@ void StringDedup::Table::deduplicate(oop java_string) {
         // good target for future deduplications as it is probably intended
         // to live for some time.
         tv.replace(value);
-        _cur_stat.inc_replaced();
+        stat->inc_replaced();
       }
     }
   }
@@ -669,6 +713,18 @@ bool StringDedup::Table::cleanup_start_if_needed(bool grow_only, bool force) {
   }
 }
 
+bool StringDedup::Table::grow_start_if_needed(size_t expected_new) {
+  assert(_cleanup_state == nullptr, "cleanup already in progress");
+  if (!is_dead_count_good_acquire()) return false;
+  size_t dead_count = Atomic::load(&_dead_count);
+  assert(dead_count <= _number_of_entries, "invariant");
+  size_t adjusted = _number_of_entries - dead_count + expected_new;
+  if (Config::should_grow_table(_number_of_buckets, adjusted)) {
+    return start_resizer(true /* grow_only */, adjusted);
+  }
+  return false;
+}
+
 void StringDedup::Table::set_dead_state_cleaning() {
   MutexLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
   Atomic::store(&_dead_count, size_t(0));
@@ -46,8 +46,12 @@ class OopStorage;
 // controlling the growth or shrinkage of the hashtable.
 //
 // Operations on the table are not thread-safe.  Only the deduplication
-// thread calls most of the operations on the table.  The only exception is
-// the GC dead object count notification and the management of its state.
+// thread calls most of the operations on the table.  The exceptions are the
+// GC dead object count notification and the management of its state, and
+// deduplicate, which may be called concurrently by multiple processing
+// threads when StringDeduplicationThreads > 1.  In that case entries are
+// protected by striped bucket locks, and the processing threads must not
+// overlap with a cleanup.
 //
 // The table supports resizing and removal of entries for byte arrays that
 // have become unreferenced.  These operations are performed by the
@@ -62,6 +66,7 @@ class OopStorage;
 class StringDedup::Table : AllStatic {
 private:
   class Bucket;
+  class BucketLocker;
   class CleanupState;
   class Resizer;
   class Cleaner;
@@ -85,6 +90,8 @@ class StringDedup::Table : AllStatic {
   static size_t _grow_threshold;
   static CleanupState* _cleanup_state;
   static bool _need_bucket_shrinking;
+  // Striped locks for buckets, only used with multiple processing threads.
+  static volatile int* _bucket_locks;
   // These are always written while holding StringDedup_lock, but may be
   // read by the dedup thread without holding the lock lock.
   static volatile size_t _dead_count;
@@ -94,10 +101,10 @@ class StringDedup::Table : AllStatic {
   static size_t hash_to_index(uint hash_code);
   static void add(TableValue tv, uint hash_code);
   static TableValue find(typeArrayOop obj, uint hash_code);
-  static void install(typeArrayOop obj, uint hash_code);
+  static void install(typeArrayOop obj, uint hash_code, Stat* stat);
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
-  static bool try_deduplicate_shared(oop java_string);
-  static bool try_deduplicate_found_shared(oop java_string, oop found);
+  static bool try_deduplicate_shared(oop java_string, Stat* stat);
+  static bool try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
   static Bucket* make_buckets(size_t number_of_buckets, size_t reserve = 0);
   static void free_buckets(Bucket* buckets, size_t number_of_buckets);
 
@@ -114,8 +121,10 @@ class StringDedup::Table : AllStatic {
 
   // Deduplicate java_string.  If the table already contains the string's
   // data array, replace the string's data array with the one in the table.
-  // Otherwise, add the string's data array to the table.
-  static void deduplicate(oop java_string);
+  // Otherwise, add the string's data array to the table.  Operation
+  // counters are recorded in stat.
+  // precondition: no cleanup is in progress if called concurrently.
+  static void deduplicate(oop java_string, Stat* stat);
 
   // Returns true if table needs to grow.
   static bool is_grow_needed();
@@ -129,6 +138,12 @@ class StringDedup::Table : AllStatic {
   // precondition: no cleanup is in progress.
   static bool cleanup_start_if_needed(bool grow_only, bool force);
 
+  // If adding expected_new entries would make the table need to grow, setup
+  // a resize to a size that can hold them and return true.  If result is
+  // true, the caller must eventually call cleanup_end.
+  // precondition: no cleanup is in progress.
+  static bool grow_start_if_needed(size_t expected_new);
+
   // Perform some cleanup work.  Returns true if any progress was made,
   // false if there is no further work to do.
   // precondition: a cleanup is in progress.
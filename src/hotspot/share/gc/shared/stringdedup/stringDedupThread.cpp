@@ -30,20 +30,39 @@
 #include "runtime/os.hpp"
 #include "utilities/exceptions.hpp"
 
-StringDedupThread::StringDedupThread() : JavaThread(thread_entry) {}
+StringDedupThread::StringDedupThread(uint worker_id) :
+  JavaThread(thread_entry),
+  _worker_id(worker_id)
+{}
 
-void StringDedupThread::initialize() {
-  EXCEPTION_MARK;
-
-  const char* name = "StringDedupThread";
+void StringDedupThread::create_thread(uint worker_id, TRAPS) {
+  char name[64];
+  if (worker_id == 0) {
+    os::snprintf_checked(name, sizeof(name), "StringDedupThread");
+  } else {
+    os::snprintf_checked(name, sizeof(name), "StringDedupThread#%u", worker_id);
+  }
   Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
-  StringDedupThread* thread = new StringDedupThread();
+  StringDedupThread* thread = new StringDedupThread(worker_id);
   JavaThread::vm_exit_on_osthread_failure(thread);
   JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
 }
 
+void StringDedupThread::initialize() {
+  EXCEPTION_MARK;
+
+  for (uint i = 0; i < StringDedup::_processor->num_threads(); ++i) {
+    create_thread(i, CHECK);
+  }
+}
+
 void StringDedupThread::thread_entry(JavaThread* thread, TRAPS) {
-  StringDedup::_processor->run(thread);
+  uint worker_id = static_cast<StringDedupThread*>(thread)->_worker_id;
+  if (worker_id == 0) {
+    StringDedup::_processor->run(thread);
+  } else {
+    StringDedup::_processor->run_helper(thread, worker_id);
+  }
 }
 
 bool StringDedupThread::is_hidden_from_external_view() const {
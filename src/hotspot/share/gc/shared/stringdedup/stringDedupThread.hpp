@@ -30,9 +30,11 @@
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
 
-// Thread class for string deduplication.  There is only one instance of this
-// class.  This class provides thread management.  It uses the Processor
-// to perform most of the work.
+// Thread class for string deduplication.  There is one instance of this
+// class per processing thread, StringDeduplicationThreads in total.  The one
+// with worker id 0 is the primary deduplication thread, the others help it
+// process requests.  This class provides thread management.  It uses the
+// Processor to perform most of the work.
 //
 // Unlike most of the classes in the stringdedup implementation, this class is
 // not an inner class of StringDedup.  This is because we need a simple public
@@ -40,11 +42,15 @@
 class StringDedupThread : public JavaThread {
   friend class VMStructs;
 
-  StringDedupThread();
+  const uint _worker_id;
+
+  explicit StringDedupThread(uint worker_id);
   ~StringDedupThread() = default;
 
   NONCOPYABLE(StringDedupThread);
 
+  static void create_thread(uint worker_id, TRAPS);
+
   static void thread_entry(JavaThread* thread, TRAPS);
 
 public:
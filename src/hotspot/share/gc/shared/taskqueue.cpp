@@ -36,6 +36,7 @@
 const char * const TaskQueueStats::_names[last_stat_id] = {
   "push", "pop", "pop-slow",
   "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop",
+  "st-batch", "st-batch-ex",
   "ovflw-push", "ovflw-max"
 };
 
@@ -88,9 +89,11 @@ void TaskQueueStats::print(outputStream* stream, unsigned int width) const
 // quiescent; they do not hold at arbitrary times.
 void TaskQueueStats::verify() const
 {
-  assert(get(push) == get(pop) + get(steal_success),
-         "push=%zu pop=%zu steal=%zu",
-         get(push), get(pop), get(steal_success));
+  // Tasks taken in addition to the first one by a batch steal are pushed
+  // again onto the local queue of the thief.
+  assert(get(push) == get(pop) + get(steal_success) + get(steal_batch_extra),
+         "push=%zu pop=%zu steal=%zu steal_batch_extra=%zu",
+         get(push), get(pop), get(steal_success), get(steal_batch_extra));
   assert(get(pop_slow) <= get(pop),
          "pop_slow=%zu pop=%zu",
          get(pop_slow), get(pop));
@@ -106,6 +109,9 @@ void TaskQueueStats::verify() const
   assert(get(steal_empty) + get(steal_contended) + get(steal_success) == get(steal_attempt),
          "steal_empty=%zu steal_contended=%zu steal_success=%zu steal_attempt=%zu",
          get(steal_empty), get(steal_contended), get(steal_success), get(steal_attempt));
+  assert(get(steal_batch) <= get(steal_success),
+         "steal_batch=%zu steal_success=%zu",
+         get(steal_batch), get(steal_success));
   assert(get(overflow) == 0 || get(push) != 0,
          "overflow=%zu push=%zu",
          get(overflow), get(push));
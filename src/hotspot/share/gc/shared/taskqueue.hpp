@@ -61,6 +61,8 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batch,      // subset of successful steals that took more than one task
+    steal_batch_extra, // number of additional tasks taken by batch steals
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +84,10 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batch(uint num_stolen) {
+    ++_stats[steal_batch];
+    _stats[steal_batch_extra] += num_stolen - 1;
+  }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -362,6 +368,9 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
 private:
   // Slow path for pop_local, dealing with possible conflict with pop_global.
   bool pop_local_slow(uint localBot, Age oldAge);
+  // Slow path for pop_local when fewer than TaskQueueStealBatchSize elements
+  // remain, dealing with possible conflict with pop_global_batch.
+  bool pop_local_batch_slow(E& t, uint threshold, uint localBot, Age oldAge);
 
 public:
   typedef E element_type;
@@ -383,6 +392,11 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
   // recently pushed).
   PopResult pop_global(E& t);
 
+  // Like pop_global(), but claims up to half of the elements in the queue,
+  // at most max_num, with a single CAS. On success the claimed elements are
+  // stored in ts[0..num) in queue order.
+  PopResult pop_global_batch(E* ts, uint max_num, uint& num);
+
   // Delete any resource associated with the queue.
   ~GenericTaskQueue();
 
@@ -485,6 +499,14 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // Steals from the queue victim into t. If TaskQueueStealBatchSize allows,
+  // up to that many tasks are taken at once, and all but the first are pushed
+  // onto the local queue of queue_num.
+  PopResult steal_from(uint queue_num, uint victim, E& t);
+
+  // Upper bound of TaskQueueStealBatchSize.
+  static const uint MaxStealBatchSize = 64;
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -27,6 +27,7 @@
 
 #include "gc/shared/taskqueue.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -187,6 +188,31 @@ bool GenericTaskQueue<E, F, N>::pop_local_slow(uint localBot, Age oldAge) {
   return false;
 }
 
+// pop_local_batch_slow() is done by the owning thread when only a few
+// elements remain in the queue, so that a concurrent pop_global_batch()
+// could also have claimed the element at localBot.  The owner claims it
+// by incrementing the tag without moving top, which makes the CAS of any
+// competing pop_global() or pop_global_batch() that read the old age fail.
+template<class E, MEMFLAGS F, unsigned int N>
+bool GenericTaskQueue<E, F, N>::pop_local_batch_slow(E& t, uint threshold, uint localBot, Age oldAge) {
+  if (clean_size(localBot, oldAge.top()) == 0) {
+    // Competing steals have left at most this one element.
+    return pop_local_slow(localBot, oldAge);
+  }
+  Age newAge(oldAge.top(), (idx_t)(oldAge.tag() + 1));
+  Age tempAge = cmpxchg_age(oldAge, newAge);
+  if (tempAge == oldAge) {
+    assert_not_underflow(localBot, age_top_relaxed());
+    TASKQUEUE_STATS_ONLY(stats.record_pop_slow());
+    return true;
+  }
+  // A competing steal moved top, possibly past localBot.  Undo the
+  // decrement of bottom and start over; a steal never moves top past the
+  // bottom we had before the decrement.
+  release_set_bottom(increment_index(localBot));
+  return pop_local(t, threshold);
+}
+
 template<class E, MEMFLAGS F, unsigned int N> inline bool
 GenericTaskQueue<E, F, N>::pop_local(E& t, uint threshold) {
   uint localBot = bottom_relaxed();
@@ -207,11 +233,18 @@ GenericTaskQueue<E, F, N>::pop_local(E& t, uint threshold) {
   // If there's still at least one element in the queue, based on the
   // "_bottom" and "age" we've read, then there can be no interference with
   // a "pop_global" operation, and we're done.
+  // With batch stealing a pop_global_batch may claim up to
+  // TaskQueueStealBatchSize elements at once, so the element is only known
+  // to be ours if at least that many elements remain.
   idx_t tp = age_top_relaxed();
-  if (clean_size(localBot, tp) > 0) {
+  uint n_elems = clean_size(localBot, tp);
+  if (n_elems >= TaskQueueStealBatchSize) {
     assert_not_underflow(localBot, tp);
     TASKQUEUE_STATS_ONLY(stats.record_pop());
     return true;
+  } else if (n_elems > 0) {
+    OrderAccess::loadload();
+    return pop_local_batch_slow(t, threshold, localBot, age_relaxed());
   } else {
     // Otherwise, the queue contained exactly one element; we take the slow
     // path.
@@ -292,6 +325,47 @@ typename GenericTaskQueue<E, F, N>::PopResult GenericTaskQueue<E, F, N>::pop_glo
   return resAge == oldAge ? PopResult::Success : PopResult::Contended;
 }
 
+// pop_global_batch() claims the oldest elements of the queue like
+// pop_global(), but up to max_num of them with a single CAS on age. It never
+// takes more than half of the elements it observed, and max_num must not
+// exceed TaskQueueStealBatchSize, the number of elements pop_local() keeps
+// between bottom and top before it synchronizes with thieves.  A thief that
+// read a stale bottom can therefore not claim elements that the owner has
+// already popped, and any later thief reads a bottom at least as recent as
+// the last owner pop that did not synchronize via age.
+template<class E, MEMFLAGS F, unsigned int N>
+typename GenericTaskQueue<E, F, N>::PopResult
+GenericTaskQueue<E, F, N>::pop_global_batch(E* ts, uint max_num, uint& num) {
+  assert(max_num >= 1 && max_num <= TaskQueueStealBatchSize, "invalid batch size %u", max_num);
+  Age oldAge = age_relaxed();
+
+  // See pop_global().
+  OrderAccess::loadload_for_IRIW();
+
+  uint localBot = bottom_acquire();
+  uint n_elems = clean_size(localBot, oldAge.top());
+  if (n_elems == 0) {
+    return PopResult::Empty;
+  }
+
+  uint batch = clamp(n_elems / 2, 1u, max_num);
+  idx_t new_top = oldAge.top();
+  for (uint i = 0; i < batch; i++) {
+    ts[i] = _elems[new_top];
+    new_top = increment_index(new_top);
+  }
+  // Increment the tag if top wrapped, as in pop_global().
+  idx_t new_tag = oldAge.tag() + ((new_top < oldAge.top()) ? 1 : 0);
+  Age newAge(new_top, new_tag);
+  Age resAge = cmpxchg_age(oldAge, newAge);
+
+  if (resAge == oldAge) {
+    num = batch;
+    return PopResult::Success;
+  }
+  return PopResult::Contended;
+}
+
 inline int randomParkAndMiller(int *seed0) {
   const int a =      16807;
   const int m = 2147483647;
@@ -316,6 +390,30 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class T, MEMFLAGS F>
+typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_from(uint queue_num, uint victim, E& t) {
+  T* const local_queue = queue(queue_num);
+  // Only take a batch if all extra tasks are sure to fit into the local queue.
+  if (TaskQueueStealBatchSize == 1 ||
+      local_queue->size() + TaskQueueStealBatchSize > local_queue->max_elems()) {
+    return queue(victim)->pop_global(t);
+  }
+
+  E tasks[MaxStealBatchSize];
+  uint num = 0;
+  PopResult res = queue(victim)->pop_global_batch(tasks, TaskQueueStealBatchSize, num);
+  if (res == PopResult::Success) {
+    t = tasks[0];
+    // This thread owns the local queue, so it may push the remaining tasks.
+    for (uint i = 1; i < num; i++) {
+      bool pushed = local_queue->push(tasks[i]);
+      assert(pushed, "must fit into local queue");
+    }
+    TASKQUEUE_STATS_ONLY(if (num > 1) local_queue->stats.record_steal_batch(num);)
+  }
+  return res;
+}
+
 template<class T, MEMFLAGS F>
 typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   T* const local_queue = queue(queue_num);
@@ -344,11 +442,11 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
 
     if (sz2 > sz1) {
       sel_k = k2;
-      suc = queue(k2)->pop_global(t);
+      suc = steal_from(queue_num, k2, t);
       TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(suc);)
     } else if (sz1 > 0) {
       sel_k = k1;
-      suc = queue(k1)->pop_global(t);
+      suc = steal_from(queue_num, k1, t);
       TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(suc);)
     }
 
@@ -362,7 +460,7 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
   } else if (_n == 2) {
     // Just try the other one.
     uint k = (queue_num + 1) % 2;
-    PopResult res = queue(k)->pop_global(t);
+    PopResult res = steal_from(queue_num, k, t);
     TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
     return res;
   } else {
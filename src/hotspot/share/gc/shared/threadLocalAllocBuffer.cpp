@@ -109,6 +109,13 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+    if (TLABShrinkIdleThreads && used > 0.5 * capacity) {
+      // The thread did not take a TLAB since the last GC. Sample what it did
+      // allocate, typically nothing, so that an idle thread's desired size
+      // decays instead of staying at what it needed when it was busy.
+      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+      _allocation_fraction.sample(alloc_frac);
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -84,6 +84,10 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(bool, TLABShrinkIdleThreads, false, EXPERIMENTAL,                 \
+          "Decay the allocation fraction of threads that did not refill "   \
+          "their TLAB between two GCs, so idle threads get small TLABs")    \
+                                                                            \
 
 // end of TLAB_FLAGS
 
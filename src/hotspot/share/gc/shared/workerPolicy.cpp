@@ -124,6 +124,13 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  if (LimitThreadsToActiveProcessors) {
+    // Do not run more workers than there are processors available now,
+    // e.g. after the container CPU quota has been lowered.
+    uintx active_workers_by_cpus = MAX2((uintx) os::active_processor_count(), min_workers);
+    new_active_workers = MIN2(new_active_workers, active_workers_by_cpus);
+  }
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
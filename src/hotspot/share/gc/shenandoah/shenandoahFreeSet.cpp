@@ -61,11 +61,37 @@ bool ShenandoahFreeSet::is_collector_free(size_t idx) const {
   return _collector_free_bitmap.at(idx);
 }
 
+size_t ShenandoahFreeSet::next_mutator_free(size_t beg) const {
+  size_t end = _mutator_rightmost + 1;
+  if (beg >= end) {
+    return _max;
+  }
+  size_t idx = _mutator_free_bitmap.find_first_set_bit(beg, end);
+  return idx < end ? idx : _max;
+}
+
+size_t ShenandoahFreeSet::prev_mutator_free(size_t end) const {
+  if (_mutator_leftmost >= end) {
+    return _max;
+  }
+  size_t idx = _mutator_free_bitmap.find_last_set_bit(_mutator_leftmost, end);
+  return idx < end ? idx : _max;
+}
+
+size_t ShenandoahFreeSet::prev_collector_free(size_t end) const {
+  if (_collector_leftmost >= end) {
+    return _max;
+  }
+  size_t idx = _collector_free_bitmap.find_last_set_bit(_collector_leftmost, end);
+  return idx < end ? idx : _max;
+}
+
 HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool& in_new_region) {
   // Scan the bitmap looking for a first fit.
   //
   // Leftmost and rightmost bounds provide enough caching to walk bitmap efficiently. Normally,
-  // we would find the region to allocate at right away.
+  // we would find the region to allocate at right away. Within the bounds, the bitmap is
+  // searched a word at a time, so long runs of retired regions are skipped quickly.
   //
   // Allocations are biased: new application allocs go to beginning of the heap, and GC allocs
   // go to the end. This makes application allocation faster, because we would clear lots
@@ -79,12 +105,10 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_shared: {
 
       // Try to allocate in the mutator view
-      for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
-        if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != nullptr) {
-            return result;
-          }
+      for (size_t idx = next_mutator_free(_mutator_leftmost); idx < _max; idx = next_mutator_free(idx + 1)) {
+        HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+        if (result != nullptr) {
+          return result;
         }
       }
 
@@ -93,16 +117,11 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     }
     case ShenandoahAllocRequest::_alloc_gclab:
     case ShenandoahAllocRequest::_alloc_shared_gc: {
-      // size_t is unsigned, need to dodge underflow when _leftmost = 0
-
       // Fast-path: try to allocate in the collector view first
-      for (size_t c = _collector_rightmost + 1; c > _collector_leftmost; c--) {
-        size_t idx = c - 1;
-        if (is_collector_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != nullptr) {
-            return result;
-          }
+      for (size_t idx = prev_collector_free(_collector_rightmost + 1); idx < _max; idx = prev_collector_free(idx)) {
+        HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+        if (result != nullptr) {
+          return result;
         }
       }
 
@@ -112,16 +131,13 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
       }
 
       // Try to steal the empty region from the mutator view
-      for (size_t c = _mutator_rightmost + 1; c > _mutator_leftmost; c--) {
-        size_t idx = c - 1;
-        if (is_mutator_free(idx)) {
-          ShenandoahHeapRegion* r = _heap->get_region(idx);
-          if (can_allocate_from(r)) {
-            flip_to_gc(r);
-            HeapWord *result = try_allocate_in(r, req, in_new_region);
-            if (result != nullptr) {
-              return result;
-            }
+      for (size_t idx = prev_mutator_free(_mutator_rightmost + 1); idx < _max; idx = prev_mutator_free(idx)) {
+        ShenandoahHeapRegion* r = _heap->get_region(idx);
+        if (can_allocate_from(r)) {
+          flip_to_gc(r);
+          HeapWord *result = try_allocate_in(r, req, in_new_region);
+          if (result != nullptr) {
+            return result;
           }
         }
       }
@@ -225,21 +241,18 @@ void ShenandoahFreeSet::recompute_bounds() {
   adjust_bounds();
 }
 
+static size_t rewind_rightmost(const CHeapBitMap& bitmap, size_t rightmost) {
+  size_t idx = bitmap.find_last_set_bit(0, rightmost + 1);
+  return idx <= rightmost ? idx : 0;
+}
+
 void ShenandoahFreeSet::adjust_bounds() {
   // Rewind both mutator bounds until the next bit.
-  while (_mutator_leftmost < _max && !is_mutator_free(_mutator_leftmost)) {
-    _mutator_leftmost++;
-  }
-  while (_mutator_rightmost > 0 && !is_mutator_free(_mutator_rightmost)) {
-    _mutator_rightmost--;
-  }
+  _mutator_leftmost = _mutator_free_bitmap.find_first_set_bit(_mutator_leftmost);
+  _mutator_rightmost = rewind_rightmost(_mutator_free_bitmap, _mutator_rightmost);
   // Rewind both collector bounds until the next bit.
-  while (_collector_leftmost < _max && !is_collector_free(_collector_leftmost)) {
-    _collector_leftmost++;
-  }
-  while (_collector_rightmost > 0 && !is_collector_free(_collector_rightmost)) {
-    _collector_rightmost--;
-  }
+  _collector_leftmost = _collector_free_bitmap.find_first_set_bit(_collector_leftmost);
+  _collector_rightmost = rewind_rightmost(_collector_free_bitmap, _collector_rightmost);
 }
 
 HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
@@ -265,9 +278,16 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
       return nullptr;
     }
 
-    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
+    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward
+    // to the next free region.
+    if (!is_mutator_free(end)) {
+      end = _mutator_free_bitmap.find_first_set_bit(end + 1);
+      beg = end;
+      continue;
+    }
+
     // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
-    if (!is_mutator_free(end) || !can_allocate_from(_heap->get_region(end))) {
+    if (!can_allocate_from(_heap->get_region(end))) {
       end++;
       beg = end;
       continue;
@@ -48,6 +48,14 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   bool is_mutator_free(size_t idx) const;
   bool is_collector_free(size_t idx) const;
 
+  // Find the next free region in the mutator or collector view with a word-wise
+  // bitmap search, staying within the current bounds of the view.
+  // next_* returns the first free region in [beg; rightmost], prev_* returns the
+  // last free region in [leftmost; end). Both return _max if there is none.
+  size_t next_mutator_free(size_t beg) const;
+  size_t prev_mutator_free(size_t end) const;
+  size_t prev_collector_free(size_t end) const;
+
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
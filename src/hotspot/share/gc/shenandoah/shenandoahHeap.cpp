@@ -1309,6 +1309,11 @@ void ShenandoahHeap::print_tracing_info() const {
     ls.cr();
     ls.cr();
 
+    _lock.print_stats_on(&ls, "Heap lock");
+
+    ls.cr();
+    ls.cr();
+
     shenandoah_policy()->print_gc_stats(&ls);
 
     ls.cr();
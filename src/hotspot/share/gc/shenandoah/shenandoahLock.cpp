@@ -31,6 +31,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/os.inline.hpp"
+#include "utilities/ostream.hpp"
 
 // These are inline variants of Thread::SpinAcquire with optional blocking in VM.
 
@@ -43,11 +44,25 @@ class ShenandoahNoBlockOp : public StackObj {
 
 void ShenandoahLock::contended_lock(bool allow_block_for_safepoint) {
   Thread* thread = Thread::current();
+  jlong start = os::javaTimeNanos();
   if (allow_block_for_safepoint && thread->is_Java_thread()) {
     contended_lock_internal<ThreadBlockInVM>(JavaThread::cast(thread));
   } else {
     contended_lock_internal<ShenandoahNoBlockOp>(nullptr);
   }
+  // We hold the lock now.
+  _contended_acquisitions++;
+  _contended_wait_ns += os::javaTimeNanos() - start;
+}
+
+void ShenandoahLock::print_stats_on(outputStream* out, const char* name) const {
+  size_t acquisitions = _acquisitions;
+  size_t contended = _contended_acquisitions;
+  double wait_ms = (double)_contended_wait_ns / NANOSECS_PER_MILLISEC;
+  out->print_cr("%s: " SIZE_FORMAT " acquisitions, " SIZE_FORMAT " contended (%.2f%%), "
+                "%.3f ms total wait (a = %.3f us)",
+                name, acquisitions, contended, percent_of(contended, acquisitions),
+                wait_ms, contended > 0 ? wait_ms * 1000.0 / contended : 0.0);
 }
 
 template<typename BlockOp>
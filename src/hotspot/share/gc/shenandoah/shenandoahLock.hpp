@@ -38,13 +38,19 @@ class ShenandoahLock  {
   volatile LockState _state;
   shenandoah_padding(1);
   volatile Thread* _owner;
+  // Statistics, only updated by the lock holder.
+  size_t _acquisitions;
+  size_t _contended_acquisitions;
+  jlong _contended_wait_ns;
   shenandoah_padding(2);
 
   template<typename BlockOp>
   void contended_lock_internal(JavaThread* java_thread);
 
 public:
-  ShenandoahLock() : _state(unlocked), _owner(nullptr) {};
+  ShenandoahLock() :
+    _state(unlocked), _owner(nullptr),
+    _acquisitions(0), _contended_acquisitions(0), _contended_wait_ns(0) {};
 
   void lock(bool allow_block_for_safepoint) {
     assert(Atomic::load(&_owner) != Thread::current(), "reentrant locking attempt, would deadlock");
@@ -57,6 +63,7 @@ class ShenandoahLock  {
     assert(Atomic::load(&_state) == locked, "must be locked");
     assert(Atomic::load(&_owner) == nullptr, "must not be owned");
     DEBUG_ONLY(Atomic::store(&_owner, Thread::current());)
+    _acquisitions++;
   }
 
   void unlock() {
@@ -68,6 +75,15 @@ class ShenandoahLock  {
 
   void contended_lock(bool allow_block_for_safepoint);
 
+  // Number of acquisitions, how many of them had to wait for another holder,
+  // and the total time spent waiting. Read without the lock, so the values
+  // are only approximate while the lock is in use.
+  size_t acquisitions() const            { return _acquisitions; }
+  size_t contended_acquisitions() const  { return _contended_acquisitions; }
+  jlong contended_wait_ns() const        { return _contended_wait_ns; }
+
+  void print_stats_on(outputStream* out, const char* name) const;
+
   bool owned_by_self() {
 #ifdef ASSERT
     return _state == locked && _owner == Thread::current();
@@ -55,6 +55,12 @@
  *
  * The allocatable space when GC is running is "free" at the start of phase, but the
  * accounted budget is based on "used". So, we need to adjust the tax knowing that.
+ *
+ * The tax computed at the start of the phase is only as good as the estimate of the
+ * work. With adaptive pacing, the periodic task recomputes the tax as the ratio of the
+ * remaining work to the remaining taxable free space, so that allocation bursts and
+ * mispredicted liveness are spread over the rest of the phase instead of stalling the
+ * allocators once the initial budget runs out.
  */
 
 void ShenandoahPacer::setup_for_mark() {
@@ -70,6 +76,7 @@ void ShenandoahPacer::setup_for_mark() {
   tax *= 1;                          // mark can succeed with immediate garbage, claim all available space
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
+  setup_adaptive(live, taxable, 0);
   restart_with(non_taxable, tax);
 
   log_info(gc, ergo)("Pacer for Mark. Expected Live: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
@@ -94,6 +101,7 @@ void ShenandoahPacer::setup_for_evac() {
   tax = MAX2<double>(1, tax);        // never allocate more than GC processes during the phase
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
+  setup_adaptive(used * 2, taxable, ShenandoahPacingSurcharge);
   restart_with(non_taxable, tax);
 
   log_info(gc, ergo)("Pacer for Evacuation. Used CSet: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
@@ -118,6 +126,7 @@ void ShenandoahPacer::setup_for_updaterefs() {
   tax = MAX2<double>(1, tax);        // never allocate more than GC processes during the phase
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
+  setup_adaptive(used, taxable, ShenandoahPacingSurcharge);
   restart_with(non_taxable, tax);
 
   log_info(gc, ergo)("Pacer for Update Refs. Used: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
@@ -143,6 +152,7 @@ void ShenandoahPacer::setup_for_idle() {
   size_t initial = _heap->max_capacity() / 100 * ShenandoahPacingIdleSlack;
   double tax = 1;
 
+  setup_adaptive(0, 0, 0);
   restart_with(initial, tax);
 
   log_info(gc, ergo)("Pacer for Idle. Initial: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
@@ -159,6 +169,7 @@ void ShenandoahPacer::setup_for_reset() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
   size_t initial = _heap->max_capacity();
+  setup_adaptive(0, 0, 0);
   restart_with(initial, 1.0);
 
   log_info(gc, ergo)("Pacer for Reset. Non-Taxable: " SIZE_FORMAT "%s",
@@ -182,13 +193,64 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   size_t initial = (size_t)(non_taxable_bytes * tax_rate) >> LogHeapWordSize;
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
-  Atomic::store(&_tax_rate, tax_rate);
-  Atomic::inc(&_epoch);
+  {
+    // Serialize with adjust_tax_rate(), so that a rate computed for the
+    // previous phase can not overwrite the rate of the new phase.
+    MutexLocker ml(_rate_lock, Mutex::_no_safepoint_check_flag);
+    Atomic::store(&_tax_rate, tax_rate);
+    Atomic::inc(&_epoch);
+  }
 
   // Shake up stalled waiters after budget update.
   _need_notify_waiters.try_set();
 }
 
+// The expected work of the phase is scaled like its tax: evacuation accounts
+// for the update-refs that follows by claiming only half of the free space.
+// A phase without work does not adapt. Called before restart_with(), so that
+// adjust_tax_rate() never sees the new epoch with the fields of the old phase.
+void ShenandoahPacer::setup_adaptive(size_t work_bytes, size_t taxable_bytes, double min_tax_rate) {
+  if (!ShenandoahPacingAdaptive) {
+    return;
+  }
+  _phase_work = work_bytes >> LogHeapWordSize;
+  _phase_taxable = taxable_bytes >> LogHeapWordSize;
+  _phase_min_tax_rate = min_tax_rate;
+  Atomic::store(&_phase_work_done, (size_t)0);
+  Atomic::store(&_phase_allocated, (size_t)0);
+}
+
+void ShenandoahPacer::adjust_tax_rate() {
+  assert(ShenandoahPacingAdaptive, "Only be here when adaptive pacing is enabled");
+
+  // The phase may be restarted concurrently; the lock makes the epoch, the
+  // phase fields and the published rate a consistent snapshot.
+  MutexLocker ml(_rate_lock, Mutex::_no_safepoint_check_flag);
+  size_t work = _phase_work;
+  size_t taxable = _phase_taxable;
+  if (work == 0 || taxable == 0) {
+    return;
+  }
+
+  // Keep at least a tenth of the expected work and taxable space in the
+  // estimate, so that the rate neither drops to zero when the work was
+  // underestimated, nor explodes when the free space is nearly used up;
+  // the latter is what ShenandoahPacingMaxDelay and degenerated GC handle.
+  size_t done = Atomic::load(&_phase_work_done);
+  size_t allocated = Atomic::load(&_phase_allocated);
+  size_t remaining_work = MAX2(work - MIN2(done, work), work / 10);
+  size_t remaining_free = MAX2(taxable - MIN2(allocated, taxable), taxable / 10);
+
+  double target = 1.0 * remaining_work / remaining_free * ShenandoahPacingSurcharge;
+  target = MAX2(target, _phase_min_tax_rate);
+
+  // Move half way towards the target to dampen the reaction to short bursts.
+  double cur = Atomic::load(&_tax_rate);
+  double next = (cur + target) / 2;
+
+  Atomic::store(&_tax_rate, next);
+}
+
 bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
@@ -204,6 +266,12 @@ bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
     }
     new_val = cur - tax;
   } while (Atomic::cmpxchg(&_budget, cur, new_val, memory_order_relaxed) != cur);
+
+  // Words given back by unpace_for_alloc() stay accounted as allocated,
+  // which errs on the side of a higher tax.
+  if (ShenandoahPacingAdaptive) {
+    Atomic::add(&_phase_allocated, words, memory_order_relaxed);
+  }
   return true;
 }
 
@@ -341,5 +409,8 @@ void ShenandoahPacer::print_cycle_on(outputStream* out) {
 
 void ShenandoahPeriodicPacerNotifyTask::task() {
   assert(ShenandoahPacing, "Should not be here otherwise");
+  if (ShenandoahPacingAdaptive) {
+    _pacer->adjust_tax_rate();
+  }
   _pacer->notify_waiters();
 }
@@ -56,6 +56,8 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * With ShenandoahPacingAdaptive, the tax rate is periodically recomputed from the
+ * remaining work and the remaining free space of the current phase.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -63,6 +65,7 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   double _last_time;
   TruncatedSeq* _progress_history;
   Monitor* _wait_monitor;
+  Mutex* _rate_lock;
   ShenandoahSharedFlag _need_notify_waiters;
   ShenandoahPeriodicPacerNotifyTask _notify_waiters_task;
 
@@ -80,17 +83,34 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Adaptive pacing: expected GC work and taxable free space of the current
+  // phase, both in words, and the work done and words allocated so far.
+  size_t _phase_work;
+  size_t _phase_taxable;
+  double _phase_min_tax_rate;
+  shenandoah_padding(4);
+  volatile size_t _phase_work_done;
+  shenandoah_padding(5);
+  volatile size_t _phase_allocated;
+  shenandoah_padding(6);
+
 public:
   explicit ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
           _last_time(os::elapsedTime()),
           _progress_history(new TruncatedSeq(5)),
           _wait_monitor(new Monitor(Mutex::safepoint-1, "ShenandoahWaitMonitor_lock", true)),
+          _rate_lock(new Mutex(Mutex::nosafepoint, "ShenandoahPacerRate_lock")),
           _notify_waiters_task(this),
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {
+          _progress(PACING_PROGRESS_UNINIT),
+          _phase_work(0),
+          _phase_taxable(0),
+          _phase_min_tax_rate(0),
+          _phase_work_done(0),
+          _phase_allocated(0) {
     _notify_waiters_task.enroll();
   }
 
@@ -113,6 +133,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   void notify_waiters();
 
+  // Recompute the tax rate from the progress of the current phase.
+  void adjust_tax_rate();
+
   intptr_t epoch();
 
   void flush_stats_to_cycle();
@@ -121,9 +144,11 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
   inline void report_internal(size_t words);
   inline void report_progress_internal(size_t words);
+  inline void report_phase_work(size_t words);
 
   inline void add_budget(size_t words);
   void restart_with(size_t non_taxable_bytes, double tax_rate);
+  void setup_adaptive(size_t work_bytes, size_t taxable_bytes, double min_tax_rate);
 
   size_t update_and_get_progress_history();
 
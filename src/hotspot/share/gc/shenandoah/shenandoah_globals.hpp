@@ -268,6 +268,11 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  product(bool, ShenandoahPacingAdaptive, false, EXPERIMENTAL,              \
+          "Continuously adjust the pacing tax rate during mark, evacuation "\
+          "and update-refs from the measured GC progress and allocation, "  \
+          "instead of using the rate computed at the start of the phase.")  \
+                                                                            \
   product(uintx, ShenandoahCriticalFreeThreshold, 1, EXPERIMENTAL,          \
           "How much of the heap needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC to be claimed successful. If this "\
@@ -24,15 +24,30 @@
 #include "precompiled.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zBarrierSetRuntime.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "oops/access.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 
+static zaddress record_page_heat(zaddress addr) {
+  // Mutator load barrier slow path hits on old pages are used as a
+  // cheap sample of how frequently the objects on that page are accessed
+  if (ZPageHeatTracking && !is_null(addr)) {
+    ZPage* const page = ZHeap::heap()->page(addr);
+    if (page->is_old()) {
+      page->record_access();
+    }
+  }
+
+  return addr;
+}
+
 JRT_LEAF(oopDesc*, ZBarrierSetRuntime::load_barrier_on_oop_field_preloaded(oopDesc* o, oop* p))
-  return to_oop(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o)));
+  return to_oop(record_page_heat(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o))));
 JRT_END
 
 JRT_LEAF(zpointer, ZBarrierSetRuntime::load_barrier_on_oop_field_preloaded_store_good(oopDesc* o, oop* p))
-  return ZAddress::color(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o)), ZPointerStoreGoodMask);
+  return ZAddress::color(record_page_heat(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o))), ZPointerStoreGoodMask);
 JRT_END
 
 JRT_LEAF(oopDesc*, ZBarrierSetRuntime::load_barrier_on_weak_oop_field_preloaded(oopDesc* o, oop* p))
@@ -30,6 +30,12 @@ class ZMovableBitMap : public CHeapBitMap {
 public:
   ZMovableBitMap();
   ZMovableBitMap(ZMovableBitMap&& bitmap);
+
+  // Atomically set count bits, where index_at(i) returns the index of the
+  // i:th bit. The indices must be sorted, so that bits in the same bitmap
+  // word can be set with a single atomic operation.
+  template <typename Function /* idx_t(size_t i) */>
+  void par_set_sorted_bits(size_t count, Function index_at);
 };
 
 class ZBitMap : public CHeapBitMap {
@@ -39,6 +39,41 @@ inline ZMovableBitMap::ZMovableBitMap(ZMovableBitMap&& bitmap)
   bitmap.update(nullptr, 0);
 }
 
+template <typename Function>
+inline void ZMovableBitMap::par_set_sorted_bits(size_t count, Function index_at) {
+  size_t i = 0;
+
+  while (i < count) {
+    // Collect all bits in the same word
+    const idx_t first = index_at(i);
+    volatile bm_word_t* const addr = word_addr(first);
+    bm_word_t mask = bit_mask(first);
+
+    for (i++; i < count; i++) {
+      const idx_t index = index_at(i);
+      assert(index >= first, "Not sorted");
+      if (word_addr(index) != addr) {
+        break;
+      }
+
+      mask |= bit_mask(index);
+    }
+
+    // Set all collected bits
+    bm_word_t old_val = Atomic::load(addr);
+    while ((old_val | mask) != old_val) {
+      const bm_word_t cur_val = Atomic::cmpxchg(addr, old_val, old_val | mask, memory_order_relaxed);
+      if (cur_val == old_val) {
+        // Success
+        break;
+      }
+
+      // The value changed, retry
+      old_val = cur_val;
+    }
+  }
+}
+
 inline ZBitMap::ZBitMap(idx_t size_in_bits)
   : CHeapBitMap(size_in_bits, mtGC, false /* clear */) {}
 
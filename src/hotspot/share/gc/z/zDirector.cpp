@@ -31,6 +31,7 @@
 #include "gc/z/zHeuristics.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zTracer.inline.hpp"
 #include "logging/log.hpp"
 
 ZDirector* ZDirector::_director;
@@ -143,6 +144,25 @@ static double select_young_gc_workers(const ZDirectorStats& stats, double serial
   return gc_workers;
 }
 
+static double short_horizon_alloc_rate(const ZStatMutatorAllocRateStats& alloc_rate_stats, bool conservative) {
+  if (!ZShortHorizonAllocationRate) {
+    return 0.0;
+  }
+
+  // The short horizon allocation rate reacts to allocation bursts long
+  // before they show up in the long-term moving average. It is sampled
+  // over a much shorter interval and is therefore also much noisier, so
+  // we only add one sigma to account for the variance. We also only use
+  // it when more than one CPU is allocating, since a single allocating
+  // thread refilling its TLAB shows up as a burst on its own.
+  if (alloc_rate_stats._short_active_cpus <= 1) {
+    return 0.0;
+  }
+
+  const double short_alloc_rate = alloc_rate_stats._short_avg + alloc_rate_stats._short_sd;
+  return conservative ? short_alloc_rate * ZAllocationSpikeTolerance : short_alloc_rate;
+}
+
 static ZDriverRequest rule_minor_allocation_rate_dynamic(const ZDirectorStats& stats,
                                                          double serial_gc_time_passed,
                                                          double parallel_gc_time_passed,
@@ -170,8 +190,9 @@ static ZDriverRequest rule_minor_allocation_rate_dynamic(const ZDirectorStats& s
   const double alloc_rate_avg = alloc_rate_stats._avg;
   const double alloc_rate_sd = alloc_rate_stats._sd;
   const double alloc_rate_sd_percent = alloc_rate_sd / (alloc_rate_avg + 1.0);
-  const double alloc_rate_conservative = (MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * one_in_1000) + 1.0;
-  const double alloc_rate = conservative_alloc_rate ? alloc_rate_conservative : alloc_rate_stats._avg;
+  const double alloc_rate_conservative = MAX2((MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * one_in_1000) + 1.0,
+                                              short_horizon_alloc_rate(alloc_rate_stats, true /* conservative */));
+  const double alloc_rate = conservative_alloc_rate ? alloc_rate_conservative : MAX2(alloc_rate_stats._avg, short_horizon_alloc_rate(alloc_rate_stats, false /* conservative */));
   const double time_until_oom = (free / alloc_rate) / (1.0 + alloc_rate_sd_percent);
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -207,7 +228,12 @@ static ZDriverRequest rule_minor_allocation_rate_dynamic(const ZDirectorStats& s
   // close is 5% of the time left until OOM. If we don't check that we
   // are "close", then the heuristics instead add more threads and we
   // end up not triggering GCs until we have the max number of threads.
-  if (time_until_gc > time_until_oom * 0.05) {
+  const bool start_gc = time_until_gc <= time_until_oom * 0.05;
+
+  ZTracer::report_minor_allocation_rate(conservative_alloc_rate ? "Dynamic Conservative" : "Dynamic",
+                                        alloc_rate_stats, alloc_rate, free, time_until_gc, actual_gc_workers, start_gc);
+
+  if (!start_gc) {
     return ZDriverRequest(GCCause::_no_gc, actual_gc_workers, 0);
   }
 
@@ -270,7 +296,8 @@ static bool rule_minor_allocation_rate_static(const ZDirectorStats& stats) {
   // the allocation rate variance, which means the probability is 1 in 1000
   // that a sample is outside of the confidence interval.
   const ZStatMutatorAllocRateStats alloc_rate_stats = stats._mutator_alloc_rate;
-  const double max_alloc_rate = (alloc_rate_stats._avg * ZAllocationSpikeTolerance) + (alloc_rate_stats._sd * one_in_1000);
+  const double max_alloc_rate = MAX2((alloc_rate_stats._avg * ZAllocationSpikeTolerance) + (alloc_rate_stats._sd * one_in_1000),
+                                     short_horizon_alloc_rate(alloc_rate_stats, true /* conservative */));
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -289,7 +316,11 @@ static bool rule_minor_allocation_rate_static(const ZDirectorStats& stats) {
   log_debug(gc, director)("Rule Minor: Allocation Rate (Static GC Workers), MaxAllocRate: %.1fMB/s, Free: " SIZE_FORMAT "MB, GCDuration: %.3fs, TimeUntilGC: %.3fs",
                           max_alloc_rate / M, free / M, gc_duration, time_until_gc);
 
-  return time_until_gc <= 0;
+  const bool start_gc = time_until_gc <= 0;
+
+  ZTracer::report_minor_allocation_rate("Static", alloc_rate_stats, max_alloc_rate, free, time_until_gc, ZYoungGCThreads, start_gc);
+
+  return start_gc;
 }
 
 static bool is_young_small(const ZDirectorStats& stats) {
@@ -863,6 +894,7 @@ static ZDirectorHeapStats sample_heap_stats() {
 static ZDirectorStats sample_stats() {
   ZGenerationYoung* young = ZGeneration::young();
   ZGenerationOld* old = ZGeneration::old();
+  ZStatMutatorAllocRate::sample_short_horizon();
   const ZStatMutatorAllocRateStats mutator_alloc_rate = ZStatMutatorAllocRate::stats();
   const ZDirectorHeapStats heap = sample_heap_stats();
 
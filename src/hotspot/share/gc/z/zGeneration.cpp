@@ -186,9 +186,22 @@ static double fragmentation_limit(ZGenerationId generation) {
   }
 }
 
+static bool should_skip_cold_pages(ZGenerationId generation) {
+  if (!ZPageHeatTracking || generation != ZGenerationId::old) {
+    return false;
+  }
+
+  // Only leave cold pages fragmented while there is headroom
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t used = MIN2(ZHeap::heap()->used(), soft_max_capacity);
+  const double free_percent = percent_of(soft_max_capacity - used, soft_max_capacity);
+
+  return free_percent >= ZPageHeatHeadroom;
+}
+
 void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_all) {
   // Register relocatable pages with selector
-  ZRelocationSetSelector selector(fragmentation_limit(generation));
+  ZRelocationSetSelector selector(workers(), fragmentation_limit(generation), should_skip_cold_pages(generation));
   {
     ZGenerationPagesIterator pt_iter(_page_table, _id, _page_allocator);
     for (ZPage* page; pt_iter.next(&page);) {
@@ -211,6 +224,11 @@ void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_a
       if (page->is_marked()) {
         // Register live page
         selector.register_live_page(page);
+
+        // Start a new heat sampling period for old pages
+        if (ZPageHeatTracking && page->is_old()) {
+          page->start_heat_period();
+        }
       } else {
         // Register empty page
         selector.register_empty_page(page);
@@ -82,7 +82,16 @@ const size_t      ZMarkStackMagazineSlots       = (ZMarkStackMagazineSize / ZMar
 const size_t      ZMarkStripeShift              = ZGranuleSizeShift;
 
 // Max number of mark stripes
-const size_t      ZMarkStripesMax               = 16; // Must be a power of two
+const size_t      ZMarkStripesMax               = 64; // Must be a power of two
+
+// Max number of mark stripes to start marking with
+const size_t      ZMarkStripesInitialMax        = 16; // Must be a power of two
+
+// Number of global steal attempts sampled before the number of mark
+// stripes is re-evaluated, and the contention ratio (contended/attempts)
+// needed to increase the number of mark stripes
+const size_t      ZMarkStripeSampleInterval     = 64;
+const size_t      ZMarkStripeContendedRatio     = 4; // 1/4
 
 // Mark cache size
 const size_t      ZMarkCacheSize                = 1024; // Must be a power of two
@@ -98,4 +107,7 @@ const size_t      ZMarkProactiveFlushMax        = 10;
 // Try complete mark timeout
 const uint64_t    ZMarkCompleteTimeout          = 200; // us
 
+// Page heat saturation limit
+const uint32_t    ZPageHeatMax                  = 255;
+
 #endif // SHARE_GC_Z_ZGLOBALS_HPP
@@ -134,6 +134,10 @@ size_t ZHeap::unused() const {
   return _page_allocator.unused();
 }
 
+ZPageCacheNUMAStats ZHeap::page_cache_numa_stats(uint32_t numa_id) const {
+  return _page_allocator.cache_numa_stats(numa_id);
+}
+
 size_t ZHeap::tlab_capacity() const {
   return capacity();
 }
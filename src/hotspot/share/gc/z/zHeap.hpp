@@ -77,6 +77,7 @@ class ZHeap {
   size_t used_young() const;
   size_t used_old() const;
   size_t unused() const;
+  ZPageCacheNUMAStats page_cache_numa_stats(uint32_t numa_id) const;
 
   size_t tlab_capacity() const;
   size_t tlab_used() const;
@@ -51,6 +51,7 @@
 #include "gc/z/zStackWatermark.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
+#include "gc/z/zTracer.inline.hpp"
 #include "gc/z/zThreadLocalAllocBuffer.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "gc/z/zUtils.inline.hpp"
@@ -87,8 +88,16 @@ ZMark::ZMark(ZGeneration* generation, ZPageTable* page_table)
     _terminate(),
     _work_nproactiveflush(0),
     _work_nterminateflush(0),
+    _work_nstealattempts(0),
+    _work_nsteals(0),
+    _work_nstealcontended(0),
+    _work_nstripesgrow(0),
     _nproactiveflush(0),
     _nterminateflush(0),
+    _nstealattempts(0),
+    _nsteals(0),
+    _nstealcontended(0),
+    _nstripesgrow(0),
     _ntrycomplete(0),
     _ncontinue(0),
     _nworkers(0) {}
@@ -102,6 +111,14 @@ size_t ZMark::calculate_nstripes(uint nworkers) const {
   // where the number of stripes must be a power of two and we want to
   // have at least one worker per stripe.
   const size_t nstripes = round_down_power_of_2(nworkers);
+  return MIN2(nstripes, ZMarkStripesInitialMax);
+}
+
+size_t ZMark::calculate_max_nstripes(uint nworkers) const {
+  // The number of stripes can grow beyond the initial number of stripes
+  // when contention is detected, but we still want to have at least one
+  // worker per stripe.
+  const size_t nstripes = round_down_power_of_2(nworkers);
   return MIN2(nstripes, ZMarkStripesMax);
 }
 
@@ -111,9 +128,13 @@ void ZMark::start() {
     verify_all_stacks_empty();
   }
 
-  // Reset flush/continue counters
+  // Reset flush/steal/continue counters
   _nproactiveflush = 0;
   _nterminateflush = 0;
+  _nstealattempts = 0;
+  _nsteals = 0;
+  _nstealcontended = 0;
+  _nstripesgrow = 0;
   _ntrycomplete = 0;
   _ncontinue = 0;
 
@@ -157,14 +178,22 @@ void ZMark::prepare_work() {
   // Set number of active workers
   _terminate.reset(_nworkers);
 
-  // Reset flush counters
+  // Reset flush/steal counters
   _work_nproactiveflush = _work_nterminateflush = 0;
+  _work_nstealattempts = _work_nsteals = _work_nstealcontended = 0;
+  _work_nstripesgrow = 0;
 }
 
 void ZMark::finish_work() {
   // Accumulate proactive/terminate flush counters
   _nproactiveflush += _work_nproactiveflush;
   _nterminateflush += _work_nterminateflush;
+
+  // Accumulate steal counters
+  _nstealattempts += _work_nstealattempts;
+  _nsteals += _work_nsteals;
+  _nstealcontended += _work_nstealcontended;
+  _nstripesgrow += _work_nstripesgrow;
 }
 
 void ZMark::follow_work_complete() {
@@ -471,7 +500,7 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
 
   if (assumed_nstripes != nstripes) {
     context->set_nstripes(nstripes);
-  } else if (nstripes < calculate_nstripes(_nworkers) && _allocator.clear_and_get_expanded_recently()) {
+  } else if (nstripes < calculate_max_nstripes(_nworkers) && _allocator.clear_and_get_expanded_recently()) {
     const size_t new_nstripes = nstripes << 1;
     _stripes.set_nstripes(new_nstripes);
     context->set_nstripes(new_nstripes);
@@ -493,7 +522,6 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
 }
 
 bool ZMark::drain(ZMarkContext* context) {
-  ZMarkThreadLocalStacks* const stacks = context->stacks();
   ZMarkStackEntry entry;
   size_t processed = 0;
 
@@ -501,10 +529,11 @@ bool ZMark::drain(ZMarkContext* context) {
   context->set_nstripes(_stripes.nstripes());
 
   // Drain stripe stacks
-  while (stacks->pop(&_allocator, &_stripes, context->stripe(), entry)) {
+  while (pop(context, entry)) {
     mark_and_follow(context, entry);
 
     if ((processed++ & 31) == 0 && rebalance_work(context)) {
+      drain_prefetch_queue(context);
       return false;
     }
   }
@@ -512,6 +541,48 @@ bool ZMark::drain(ZMarkContext* context) {
   return true;
 }
 
+void ZMark::prefetch(ZMarkStackEntry entry) const {
+  if (!entry.partial_array()) {
+    const zaddress addr = ZOffset::address(to_zoffset(entry.object_address()));
+    Prefetch::read((void*)untype(addr), 0);
+  }
+}
+
+bool ZMark::pop(ZMarkContext* context, ZMarkStackEntry& entry) {
+  ZMarkThreadLocalStacks* const stacks = context->stacks();
+
+  if (!ZMarkPrefetch) {
+    return stacks->pop(&_allocator, &_stripes, context->stripe(), entry);
+  }
+
+  // Keep the prefetch queue filled, so that an object has been prefetched
+  // a number of entries before it is marked and followed. Objects pushed
+  // while following an object end up on the mark stack, and are therefore
+  // still visited in (almost) depth-first order.
+  ZMarkPrefetchQueue* const queue = context->prefetch_queue();
+  while (!queue->is_full() && stacks->pop(&_allocator, &_stripes, context->stripe(), entry)) {
+    prefetch(entry);
+    queue->push(entry);
+  }
+
+  if (queue->is_empty()) {
+    // Nothing more to do
+    return false;
+  }
+
+  entry = queue->pop();
+  return true;
+}
+
+void ZMark::drain_prefetch_queue(ZMarkContext* context) {
+  // Entries in the prefetch queue are not visible to other threads,
+  // so they must be processed before we stop working on this stripe.
+  ZMarkPrefetchQueue* const queue = context->prefetch_queue();
+  while (!queue->is_empty()) {
+    mark_and_follow(context, queue->pop());
+  }
+}
+
 bool ZMark::try_steal_local(ZMarkContext* context) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
@@ -540,7 +611,7 @@ bool ZMark::try_steal_global(ZMarkContext* context) {
   for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
        victim_stripe != stripe;
        victim_stripe = _stripes.stripe_next(victim_stripe)) {
-    ZMarkStack* const stack = victim_stripe->steal_stack();
+    ZMarkStack* const stack = victim_stripe->steal_stack(context->nstealcontended_addr());
     if (stack != nullptr) {
       // Success, install the stolen stack
       stacks->install(&_stripes, stripe, stack);
@@ -553,7 +624,64 @@ bool ZMark::try_steal_global(ZMarkContext* context) {
 }
 
 bool ZMark::try_steal(ZMarkContext* context) {
-  return try_steal_local(context) || try_steal_global(context);
+  if (try_steal_local(context)) {
+    return true;
+  }
+
+  const bool success = try_steal_global(context);
+  context->inc_nstealattempts(success);
+
+  if (context->nstealattempts() >= ZMarkStripeSampleInterval) {
+    adapt_nstripes(context);
+  }
+
+  return success;
+}
+
+void ZMark::sample_steal_stats(ZMarkContext* context) {
+  if (context->nstealattempts() > 0) {
+    Atomic::add(&_work_nstealattempts, context->nstealattempts(), memory_order_relaxed);
+    Atomic::add(&_work_nsteals, context->nsteals(), memory_order_relaxed);
+    Atomic::add(&_work_nstealcontended, context->nstealcontended(), memory_order_relaxed);
+  }
+
+  context->reset_steal_stats();
+}
+
+void ZMark::adapt_nstripes(ZMarkContext* context) {
+  const size_t nattempts = context->nstealattempts();
+  const size_t nsteals = context->nsteals();
+  const size_t ncontended = context->nstealcontended();
+
+  sample_steal_stats(context);
+
+  // Workers contending on the same stripe stacks when stealing means there
+  // are too many workers per stripe, so we spread them out over more stripes.
+  // However, if most steal attempts fail we are most likely just racing
+  // towards termination, where more stripes would only make things worse.
+  // Reducing the number of stripes again is handled by the termination
+  // protocol, see ZMarkTerminate::maybe_reduce_stripes().
+  const size_t nstripes = context->nstripes();
+  const bool contended = ncontended * ZMarkStripeContendedRatio >= nattempts;
+  const bool successful = nsteals * 2 >= nattempts;
+  if (!contended || !successful || nstripes >= calculate_max_nstripes(_nworkers)) {
+    return;
+  }
+
+  const size_t new_nstripes = nstripes << 1;
+  if (!_stripes.try_set_nstripes(nstripes, new_nstripes)) {
+    // Lost the race, or the number of stripes changed since we last looked
+    return;
+  }
+
+  context->set_nstripes(new_nstripes);
+  Atomic::inc(&_work_nstripesgrow, memory_order_relaxed);
+
+  log_debug(gc, marking)("Mark stripe contention: " SIZE_FORMAT "/" SIZE_FORMAT " contended/successful steal attempt(s) "
+                         "out of " SIZE_FORMAT ", stripes " SIZE_FORMAT " -> " SIZE_FORMAT,
+                         ncontended, nsteals, nattempts, nstripes, new_nstripes);
+
+  ZTracer::report_mark_stripe_rebalance(nstripes, new_nstripes, nattempts, nsteals, ncontended);
 }
 
 class ZMarkFlushAndFreeStacksClosure : public HandshakeClosure {
@@ -660,6 +788,7 @@ bool ZMark::follow_work(bool partial) {
 
   for (;;) {
     if (!drain(&context)) {
+      sample_steal_stats(&context);
       leave();
       return false;
     }
@@ -670,6 +799,7 @@ bool ZMark::follow_work(bool partial) {
     }
 
     if (partial) {
+      sample_steal_stats(&context);
       return true;
     }
 
@@ -680,6 +810,7 @@ bool ZMark::follow_work(bool partial) {
 
     if (try_terminate(&context)) {
       // Terminate
+      sample_steal_stats(&context);
       return true;
     }
   }
@@ -1003,7 +1134,8 @@ bool ZMark::end() {
   }
 
   // Update statistics
-  _generation->stat_mark()->at_mark_end(_nproactiveflush, _nterminateflush, _ntrycomplete, _ncontinue);
+  _generation->stat_mark()->at_mark_end(_nproactiveflush, _nterminateflush, _ntrycomplete, _ncontinue,
+                                        _nstealattempts, _nsteals, _nstealcontended, _nstripesgrow);
 
   // Mark completed
   return true;
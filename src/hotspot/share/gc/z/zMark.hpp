@@ -62,13 +62,22 @@ class ZMark {
   ZMarkTerminate      _terminate;
   volatile size_t     _work_nproactiveflush;
   volatile size_t     _work_nterminateflush;
+  volatile size_t     _work_nstealattempts;
+  volatile size_t     _work_nsteals;
+  volatile size_t     _work_nstealcontended;
+  volatile size_t     _work_nstripesgrow;
   size_t              _nproactiveflush;
   size_t              _nterminateflush;
+  size_t              _nstealattempts;
+  size_t              _nsteals;
+  size_t              _nstealcontended;
+  size_t              _nstripesgrow;
   size_t              _ntrycomplete;
   size_t              _ncontinue;
   uint                _nworkers;
 
   size_t calculate_nstripes(uint nworkers) const;
+  size_t calculate_max_nstripes(uint nworkers) const;
 
   bool is_array(zaddress addr) const;
   void push_partial_array(zpointer* addr, size_t length, bool finalizable);
@@ -81,10 +90,15 @@ class ZMark {
   void mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry);
 
   bool rebalance_work(ZMarkContext* context);
+  void prefetch(ZMarkStackEntry entry) const;
+  bool pop(ZMarkContext* context, ZMarkStackEntry& entry);
+  void drain_prefetch_queue(ZMarkContext* context);
   bool drain(ZMarkContext* context);
   bool try_steal_local(ZMarkContext* context);
   bool try_steal_global(ZMarkContext* context);
   bool try_steal(ZMarkContext* context);
+  void sample_steal_stats(ZMarkContext* context);
+  void adapt_nstripes(ZMarkContext* context);
   bool flush();
   bool try_proactive_flush();
   bool try_terminate(ZMarkContext* context);
@@ -25,18 +25,43 @@
 #define SHARE_GC_Z_ZMARKCONTEXT_HPP
 
 #include "gc/z/zMarkCache.hpp"
+#include "gc/z/zMarkStackEntry.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "memory/allocation.hpp"
 
 class ZMarkStripe;
 class ZMarkThreadLocalStacks;
 
+// Small FIFO of popped mark stack entries, used to issue a prefetch for
+// an object some time before it is marked and followed.
+class ZMarkPrefetchQueue {
+private:
+  static const size_t Size = 8; // Must be a power of two
+
+  ZMarkStackEntry _entries[Size];
+  size_t          _head;
+  size_t          _length;
+
+public:
+  ZMarkPrefetchQueue();
+
+  bool is_empty() const;
+  bool is_full() const;
+
+  void push(ZMarkStackEntry entry);
+  ZMarkStackEntry pop();
+};
+
 class ZMarkContext : public StackObj {
 private:
   ZMarkCache                    _cache;
   ZMarkStripe*                  _stripe;
   ZMarkThreadLocalStacks* const _stacks;
   size_t                        _nstripes;
+  size_t                        _nstealattempts;
+  size_t                        _nsteals;
+  size_t                        _nstealcontended;
+  ZMarkPrefetchQueue            _prefetch_queue;
   StringDedup::Requests         _string_dedup_requests;
 
 public:
@@ -48,10 +73,18 @@ class ZMarkContext : public StackObj {
   ZMarkStripe* stripe();
   void set_stripe(ZMarkStripe* stripe);
   ZMarkThreadLocalStacks* stacks();
+  ZMarkPrefetchQueue* prefetch_queue();
   StringDedup::Requests* string_dedup_requests();
 
   size_t nstripes();
   void set_nstripes(size_t nstripes);
+
+  size_t nstealattempts() const;
+  size_t nsteals() const;
+  size_t nstealcontended() const;
+  size_t* nstealcontended_addr();
+  void inc_nstealattempts(bool success);
+  void reset_steal_stats();
 };
 
 #endif // SHARE_GC_Z_ZMARKCONTEXT_HPP
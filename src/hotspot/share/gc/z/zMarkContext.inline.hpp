@@ -26,6 +26,35 @@
 
 #include "gc/z/zMarkContext.hpp"
 
+#include "utilities/debug.hpp"
+
+inline ZMarkPrefetchQueue::ZMarkPrefetchQueue()
+  : _entries(),
+    _head(0),
+    _length(0) {}
+
+inline bool ZMarkPrefetchQueue::is_empty() const {
+  return _length == 0;
+}
+
+inline bool ZMarkPrefetchQueue::is_full() const {
+  return _length == Size;
+}
+
+inline void ZMarkPrefetchQueue::push(ZMarkStackEntry entry) {
+  assert(!is_full(), "Queue full");
+  _entries[(_head + _length) & (Size - 1)] = entry;
+  _length++;
+}
+
+inline ZMarkStackEntry ZMarkPrefetchQueue::pop() {
+  assert(!is_empty(), "Queue empty");
+  const ZMarkStackEntry entry = _entries[_head];
+  _head = (_head + 1) & (Size - 1);
+  _length--;
+  return entry;
+}
+
 inline ZMarkContext::ZMarkContext(size_t nstripes,
                                   ZMarkStripe* stripe,
                                   ZMarkThreadLocalStacks* stacks)
@@ -33,6 +62,10 @@ inline ZMarkContext::ZMarkContext(size_t nstripes,
     _stripe(stripe),
     _stacks(stacks),
     _nstripes(nstripes),
+    _nstealattempts(0),
+    _nsteals(0),
+    _nstealcontended(0),
+    _prefetch_queue(),
     _string_dedup_requests() {}
 
 inline ZMarkCache* ZMarkContext::cache() {
@@ -51,6 +84,10 @@ inline ZMarkThreadLocalStacks* ZMarkContext::stacks() {
   return _stacks;
 }
 
+inline ZMarkPrefetchQueue* ZMarkContext::prefetch_queue() {
+  return &_prefetch_queue;
+}
+
 inline StringDedup::Requests* ZMarkContext::string_dedup_requests() {
   return &_string_dedup_requests;
 }
@@ -64,4 +101,33 @@ inline void ZMarkContext::set_nstripes(size_t nstripes) {
   _nstripes = nstripes;
 }
 
+inline size_t ZMarkContext::nstealattempts() const {
+  return _nstealattempts;
+}
+
+inline size_t ZMarkContext::nsteals() const {
+  return _nsteals;
+}
+
+inline size_t ZMarkContext::nstealcontended() const {
+  return _nstealcontended;
+}
+
+inline size_t* ZMarkContext::nstealcontended_addr() {
+  return &_nstealcontended;
+}
+
+inline void ZMarkContext::inc_nstealattempts(bool success) {
+  _nstealattempts++;
+  if (success) {
+    _nsteals++;
+  }
+}
+
+inline void ZMarkContext::reset_steal_stats() {
+  _nstealattempts = 0;
+  _nsteals = 0;
+  _nstealcontended = 0;
+}
+
 #endif // SHARE_GC_Z_ZMARKCACHE_INLINE_HPP
@@ -57,6 +57,23 @@ void ZMarkStripeSet::set_nstripes(size_t nstripes) {
   log_debug(gc, marking)("Using " SIZE_FORMAT " mark stripes", nstripes);
 }
 
+bool ZMarkStripeSet::try_set_nstripes(size_t old_nstripes, size_t new_nstripes) {
+  assert(is_power_of_2(new_nstripes), "Must be a power of two");
+  assert(new_nstripes >= 1, "Invalid number of stripes");
+  assert(new_nstripes <= ZMarkStripesMax, "Invalid number of stripes");
+
+  // Only one of several workers racing to resize the stripe set succeeds,
+  // the others will pick up the new value when they rebalance their work.
+  const size_t old_mask = old_nstripes - 1;
+  const size_t new_mask = new_nstripes - 1;
+  if (Atomic::cmpxchg(&_nstripes_mask, old_mask, new_mask) != old_mask) {
+    return false;
+  }
+
+  log_debug(gc, marking)("Using " SIZE_FORMAT " mark stripes", new_nstripes);
+  return true;
+}
+
 size_t ZMarkStripeSet::nstripes() const {
   return Atomic::load(&_nstripes_mask) + 1;
 }
@@ -26,6 +26,7 @@
 
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zMarkStackEntry.hpp"
+#include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class ZMarkTerminate;
@@ -66,7 +67,7 @@ class ZStackList {
   bool is_empty() const;
 
   void push(T* stack);
-  T* pop();
+  T* pop(size_t* ncontended = nullptr);
 
   void clear();
 };
@@ -90,7 +91,7 @@ class ZMarkStripe {
   bool is_empty() const;
 
   void publish_stack(ZMarkStack* stack, ZMarkTerminate* terminate, bool publish);
-  ZMarkStack* steal_stack();
+  ZMarkStack* steal_stack(size_t* ncontended = nullptr);
 };
 
 class ZMarkStripeSet {
@@ -102,6 +103,7 @@ class ZMarkStripeSet {
   explicit ZMarkStripeSet(uintptr_t base);
 
   void set_nstripes(size_t nstripes);
+  bool try_set_nstripes(size_t old_nstripes, size_t new_nstripes);
   size_t nstripes() const;
 
   bool is_empty() const;
@@ -115,7 +117,9 @@ class ZMarkStripeSet {
 
 class ZMarkStackAllocator;
 
-class ZMarkThreadLocalStacks {
+// The thread local stacks are allocated outside of the GC thread local
+// data area, since the per-stripe stack array is too large to fit there.
+class ZMarkThreadLocalStacks : public CHeapObj<mtGC> {
 private:
   ZMarkStackMagazine* _magazine;
   ZMarkStack*         _stacks[ZMarkStripesMax];
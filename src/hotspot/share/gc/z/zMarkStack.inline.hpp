@@ -136,7 +136,7 @@ inline void ZStackList<T>::push(T* stack) {
 }
 
 template <typename T>
-inline T* ZStackList<T>::pop() {
+inline T* ZStackList<T>::pop(size_t* ncontended) {
   T* vstack = _head;
   T* stack = nullptr;
   uint32_t version = 0;
@@ -155,6 +155,9 @@ inline T* ZStackList<T>::pop() {
     }
 
     // Retry
+    if (ncontended != nullptr) {
+      (*ncontended)++;
+    }
     vstack = prev_vstack;
   }
 }
@@ -184,14 +187,14 @@ inline void ZMarkStripe::publish_stack(ZMarkStack* stack, ZMarkTerminate* termin
   terminate->wake_up();
 }
 
-inline ZMarkStack* ZMarkStripe::steal_stack() {
+inline ZMarkStack* ZMarkStripe::steal_stack(size_t* ncontended) {
   // Steal overflowed stacks first, then published stacks
-  ZMarkStack* const stack = _overflowed.pop();
+  ZMarkStack* const stack = _overflowed.pop(ncontended);
   if (stack != nullptr) {
     return stack;
   }
 
-  return _published.pop();
+  return _published.pop(ncontended);
 }
 
 inline size_t ZMarkStripeSet::stripe_id(const ZMarkStripe* stripe) const {
@@ -40,6 +40,8 @@ ZPage::ZPage(ZPageType type, const ZVirtualMemory& vmem, const ZPhysicalMemory&
     _numa_id((uint8_t)-1),
     _seqnum(0),
     _seqnum_other(0),
+    _heat(0),
+    _heat_sampled(false),
     _virtual(vmem),
     _top(to_zoffset_end(start())),
     _livemap(object_max_count()),
@@ -143,6 +145,11 @@ void ZPage::reset(ZPageAge age, ZPageResetType type) {
   _age = age;
   _last_used = 0;
 
+  if (type == ZPageResetType::Allocation || type == ZPageResetType::Splitting || prev_age != ZPageAge::old) {
+    // The page has no heat history as an old page yet
+    clear_heat();
+  }
+
   _generation_id = age == ZPageAge::old
       ? ZGenerationId::old
       : ZGenerationId::young;
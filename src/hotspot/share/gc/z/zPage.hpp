@@ -60,6 +60,8 @@ class ZPage : public CHeapObj<mtGC> {
   uint8_t              _numa_id;
   uint32_t             _seqnum;
   uint32_t             _seqnum_other;
+  volatile uint32_t    _heat;
+  bool                 _heat_sampled;
   ZVirtualMemory       _virtual;
   volatile zoffset_end _top;
   ZLiveMap             _livemap;
@@ -128,6 +130,12 @@ class ZPage : public CHeapObj<mtGC> {
   uint64_t last_used() const;
   void set_last_used();
 
+  uint32_t heat() const;
+  bool is_cold() const;
+  void record_access();
+  void start_heat_period();
+  void clear_heat();
+
   void reset(ZPageAge age, ZPageResetType type);
 
   void finalize_reset_for_in_place_relocation();
@@ -166,6 +174,7 @@ class ZPage : public CHeapObj<mtGC> {
   void object_iterate(Function function);
 
   void remember(volatile zpointer* p);
+  void remember(volatile zpointer* const* p, size_t count);
 
   // In-place relocation support
   void clear_remset_bit_non_par_current(uintptr_t l_offset);
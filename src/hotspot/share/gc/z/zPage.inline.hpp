@@ -211,6 +211,34 @@ inline void ZPage::set_last_used() {
   _last_used = (uint64_t)ceil(os::elapsedTime());
 }
 
+inline uint32_t ZPage::heat() const {
+  return Atomic::load(&_heat);
+}
+
+inline bool ZPage::is_cold() const {
+  // Pages that were allocated or promoted since the last old
+  // collection have not been sampled for a full period yet
+  return _heat_sampled && heat() == 0;
+}
+
+inline void ZPage::record_access() {
+  // The heat saturates, which bounds the number of contended
+  // updates when mutators hit the same hot page over and over
+  if (heat() < ZPageHeatMax) {
+    Atomic::inc(&_heat, memory_order_relaxed);
+  }
+}
+
+inline void ZPage::start_heat_period() {
+  Atomic::store(&_heat, 0u);
+  _heat_sampled = true;
+}
+
+inline void ZPage::clear_heat() {
+  Atomic::store(&_heat, 0u);
+  _heat_sampled = false;
+}
+
 inline bool ZPage::is_in(zoffset offset) const {
   return offset >= start() && offset < top();
 }
@@ -362,6 +390,14 @@ inline void ZPage::remember(volatile zpointer* p) {
   _remembered_set.set_current(l_offset);
 }
 
+inline void ZPage::remember(volatile zpointer* const* p, size_t count) {
+  // The fields must be sorted and all be on this page
+  _remembered_set.set_current(count, [&](size_t i) {
+    const zaddress addr = to_zaddress((uintptr_t)p[i]);
+    return local_offset(addr);
+  });
+}
+
 inline void ZPage::clear_remset_bit_non_par_current(uintptr_t l_offset) {
   _remembered_set.unset_non_par_current(l_offset);
 }
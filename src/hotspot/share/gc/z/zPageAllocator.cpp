@@ -30,6 +30,7 @@
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zLargePages.inline.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
@@ -46,12 +47,15 @@
 #include "runtime/globals.hpp"
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 static const ZStatCounter       ZCounterMutatorAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterDefragment("Memory", "Defragment", ZStatUnitOpsPerSecond);
+static const ZStatCounter       ZCounterUncommitPartialLargePages("Memory", "Uncommit Partial Large Pages", ZStatUnitOpsPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
 ZSafePageRecycle::ZSafePageRecycle(ZPageAllocator* page_allocator)
@@ -259,17 +263,72 @@ class ZPreTouchTask : public ZTask {
   }
 };
 
+class ZPopulateTask : public ZTask {
+private:
+  ZPhysicalMemoryManager* const _physical;
+  const ZPage* const            _page;
+  volatile size_t               _claimed;
+  volatile bool                 _failed;
+
+public:
+  ZPopulateTask(ZPhysicalMemoryManager* physical, const ZPage* page)
+    : ZTask("ZPopulateTask"),
+      _physical(physical),
+      _page(page),
+      _claimed(0),
+      _failed(false) {}
+
+  virtual void work() {
+    for (;;) {
+      // Get granule offset
+      const size_t size = ZGranuleSize;
+      const size_t offset = Atomic::fetch_then_add(&_claimed, size);
+      if (offset >= _page->size()) {
+        // Done
+        break;
+      }
+
+      // Commit and pre-touch granule
+      if (!_physical->populate(_page->start() + offset, _page->physical_memory(), offset, size)) {
+        Atomic::store(&_failed, true);
+      }
+    }
+  }
+
+  bool failed() const {
+    return Atomic::load(&_failed);
+  }
+};
+
 bool ZPageAllocator::prime_cache(ZWorkers* workers, size_t size) {
+  // When pre-touching, the page can be committed lazily and have its
+  // backing memory allocated while it is pre-touched by the workers.
+  // This avoids the serial commit of the whole page before pre-touching.
+  const bool populate = AlwaysPreTouch && _physical.is_populate_supported();
+
   ZAllocationFlags flags;
   flags.set_non_blocking();
   flags.set_low_address();
+  if (populate) {
+    flags.set_lazy_commit();
+  }
 
   ZPage* const page = alloc_page(ZPageType::large, size, flags, ZPageAge::eden);
   if (page == nullptr) {
     return false;
   }
 
-  if (AlwaysPreTouch) {
+  if (populate) {
+    // Commit and pre-touch page
+    ZPopulateTask task(&_physical, page);
+    workers->run_all(&task);
+
+    if (task.failed()) {
+      // Parts of the page are not backed by memory, and must not
+      // be inserted into the page cache. Heap initialization fails.
+      return false;
+    }
+  } else if (AlwaysPreTouch) {
     // Pre-touch page
     ZPreTouchTask task(&_physical, page->start(), page->end());
     workers->run_all(&task);
@@ -335,6 +394,11 @@ ZPageAllocatorStats ZPageAllocator::stats(ZGeneration* generation) const {
                              _stalled.size());
 }
 
+ZPageCacheNUMAStats ZPageAllocator::cache_numa_stats(uint32_t numa_id) const {
+  ZLocker<ZLock> locker(&_lock);
+  return _cache.numa_stats(numa_id);
+}
+
 void ZPageAllocator::reset_statistics(ZGenerationId id) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
   _collection_stats[(int)id]._used_high = _used;
@@ -422,7 +486,13 @@ void ZPageAllocator::promote_used(size_t size) {
   increase_used_generation(ZGenerationId::old, size);
 }
 
-bool ZPageAllocator::commit_page(ZPage* page) {
+bool ZPageAllocator::commit_page(ZPage* page, bool lazy) {
+  if (lazy) {
+    // Commit physical memory lazily, the caller populates it once mapped
+    _physical.commit_lazy(page->physical_memory());
+    return true;
+  }
+
   // Commit physical memory
   return _physical.commit(page->physical_memory());
 }
@@ -676,7 +746,7 @@ ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
   }
 
   // Commit page
-  if (commit_page(page)) {
+  if (commit_page(page, allocation->flags().lazy_commit())) {
     // Success
     map_page(page);
     return page;
@@ -858,6 +928,27 @@ void ZPageAllocator::free_pages_alloc_failed(ZPageAllocation* allocation) {
   satisfy_stalled();
 }
 
+size_t ZPageAllocator::uncommit_extent_size() const {
+  // With transparent huge pages, memory should be uncommitted in whole
+  // huge pages where possible. A granule is always a whole large page
+  // when explicit large pages are used.
+  if (ZLargePages::is_transparent()) {
+    return MAX2(os::large_page_size(), ZGranuleSize);
+  }
+
+  return ZGranuleSize;
+}
+
+size_t ZPageAllocator::align_down_to_uncommit_extent(size_t size) const {
+  const size_t extent_size = uncommit_extent_size();
+  if (size < extent_size) {
+    // Less than a whole extent, uncommit what we can
+    return size;
+  }
+
+  return align_down(size, extent_size);
+}
+
 size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   // We need to join the suspendible thread set while manipulating capacity and
   // used, to make sure GC safepoints will have a consistent view.
@@ -874,10 +965,10 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     const size_t retain = MAX2(_used, _min_capacity);
     const size_t release = _capacity - retain;
     const size_t limit = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
-    const size_t flush = MIN2(release, limit);
+    const size_t flush = align_down_to_uncommit_extent(MIN2(release, limit));
 
     // Flush pages to uncommit
-    flushed = _cache.flush_for_uncommit(flush, &pages, timeout);
+    flushed = _cache.flush_for_uncommit(flush, uncommit_extent_size(), &pages, timeout);
     if (flushed == 0) {
       // Nothing flushed
       return 0;
@@ -888,8 +979,13 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   }
 
   // Unmap, uncommit, and destroy flushed pages
+  const size_t extent_size = uncommit_extent_size();
+  size_t npartial = 0;
   ZListRemoveIterator<ZPage> iter(&pages);
   for (ZPage* page; iter.next(&page);) {
+    if (extent_size > ZGranuleSize) {
+      npartial += page->physical_memory().npartial_extents(extent_size);
+    }
     unmap_page(page);
     uncommit_page(page);
     destroy_page(page);
@@ -904,6 +1000,14 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     decrease_capacity(flushed, false /* set_max_capacity */);
   }
 
+  if (npartial > 0) {
+    // Each partially uncommitted large page will be committed using
+    // small pages, and take one page fault per small page, when reused.
+    ZStatInc(ZCounterUncommitPartialLargePages, npartial);
+    log_debug(gc, heap)("Uncommit split " SIZE_FORMAT " large page(s) of " SIZE_FORMAT "M",
+                        npartial, extent_size / M);
+  }
+
   return flushed;
 }
 
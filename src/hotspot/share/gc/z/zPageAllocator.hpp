@@ -96,7 +96,7 @@ class ZPageAllocator {
   void increase_used_generation(ZGenerationId id, size_t size);
   void decrease_used_generation(ZGenerationId id, size_t size);
 
-  bool commit_page(ZPage* page);
+  bool commit_page(ZPage* page, bool lazy);
   void uncommit_page(ZPage* page);
 
   void map_page(const ZPage* page) const;
@@ -118,6 +118,8 @@ class ZPageAllocator {
 
   void satisfy_stalled();
 
+  size_t uncommit_extent_size() const;
+  size_t align_down_to_uncommit_extent(size_t size) const;
   size_t uncommit(uint64_t* timeout);
 
   void notify_out_of_memory();
@@ -145,6 +147,7 @@ class ZPageAllocator {
   void promote_used(size_t size);
 
   ZPageAllocatorStats stats(ZGeneration* generation) const;
+  ZPageCacheNUMAStats cache_numa_stats(uint32_t numa_id) const;
 
   void reset_statistics(ZGenerationId id);
 
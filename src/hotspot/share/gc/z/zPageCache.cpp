@@ -58,19 +58,27 @@ ZPageCache::ZPageCache()
   : _small(),
     _medium(),
     _large(),
+    _numa_stats(ZPageCacheNUMAStats()),
     _last_commit(0) {}
 
-ZPage* ZPageCache::alloc_small_page() {
+ZPage* ZPageCache::alloc_numa_page(ZPerNUMA<ZList<ZPage> >* lists) {
   const uint32_t numa_id = ZNUMA::id();
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
-  ZPage* const l1_page = _small.get(numa_id).remove_first();
+  ZPage* const l1_page = lists->get(numa_id).remove_first();
   if (l1_page != nullptr) {
     ZStatInc(ZCounterPageCacheHitL1);
+    _numa_stats.addr(numa_id)->_hit++;
     return l1_page;
   }
 
+  if (!ZNUMAPageCacheSteal) {
+    // Prefer committing NUMA local memory over
+    // stealing pages from remote page cache(s)
+    return nullptr;
+  }
+
   // Try NUMA remote page cache(s)
   uint32_t remote_numa_id = numa_id + 1;
   const uint32_t remote_numa_count = numa_count - 1;
@@ -79,9 +87,10 @@ ZPage* ZPageCache::alloc_small_page() {
       remote_numa_id = 0;
     }
 
-    ZPage* const l2_page = _small.get(remote_numa_id).remove_first();
+    ZPage* const l2_page = lists->get(remote_numa_id).remove_first();
     if (l2_page != nullptr) {
       ZStatInc(ZCounterPageCacheHitL2);
+      _numa_stats.addr(numa_id)->_steal++;
       return l2_page;
     }
 
@@ -91,14 +100,12 @@ ZPage* ZPageCache::alloc_small_page() {
   return nullptr;
 }
 
-ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const page = _medium.remove_first();
-  if (page != nullptr) {
-    ZStatInc(ZCounterPageCacheHitL1);
-    return page;
-  }
+ZPage* ZPageCache::alloc_small_page() {
+  return alloc_numa_page(&_small);
+}
 
-  return nullptr;
+ZPage* ZPageCache::alloc_medium_page() {
+  return alloc_numa_page(&_medium);
 }
 
 ZPage* ZPageCache::alloc_large_page(size_t size) {
@@ -109,6 +116,7 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
       // Page found
       _large.remove(page);
       ZStatInc(ZCounterPageCacheHitL1);
+      _numa_stats.addr(ZNUMA::id())->_hit++;
       return page;
     }
   }
@@ -117,8 +125,33 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
 }
 
 ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
-  if (size <= ZPageSizeMedium) {
-    return _medium.remove_first();
+  if (size > ZPageSizeMedium) {
+    return nullptr;
+  }
+
+  const uint32_t numa_id = ZNUMA::id();
+  const uint32_t numa_count = ZNUMA::count();
+
+  // Try NUMA local page cache
+  ZPage* const local_page = _medium.get(numa_id).remove_first();
+  if (local_page != nullptr) {
+    _numa_stats.addr(numa_id)->_hit++;
+    return local_page;
+  }
+
+  if (!ZNUMAPageCacheSteal) {
+    return nullptr;
+  }
+
+  // Try NUMA remote page cache(s)
+  for (uint32_t remote_numa_id = 0; remote_numa_id < numa_count; remote_numa_id++) {
+    if (remote_numa_id != numa_id) {
+      ZPage* const remote_page = _medium.get(remote_numa_id).remove_first();
+      if (remote_page != nullptr) {
+        _numa_stats.addr(numa_id)->_steal++;
+        return remote_page;
+      }
+    }
   }
 
   return nullptr;
@@ -131,6 +164,7 @@ ZPage* ZPageCache::alloc_oversized_large_page(size_t size) {
     if (size <= page->size()) {
       // Page found
       _large.remove(page);
+      _numa_stats.addr(ZNUMA::id())->_hit++;
       return page;
     }
   }
@@ -182,6 +216,7 @@ ZPage* ZPageCache::alloc_page(ZPageType type, size_t size) {
 
   if (page == nullptr) {
     ZStatInc(ZCounterPageCacheMiss);
+    _numa_stats.addr(ZNUMA::id())->_miss++;
   }
 
   return page;
@@ -192,7 +227,7 @@ void ZPageCache::free_page(ZPage* page) {
   if (type == ZPageType::small) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageType::medium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -237,12 +272,20 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
   }
 }
 
-void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
-  // Prefer flushing large, then medium and last small pages
-  flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
-  flush_per_numa_lists(cl, &_small, to);
+void ZPageCache::flush_list_any(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to) {
+  // Unlike flush_list(), this doesn't stop at the first page that
+  // shouldn't be flushed, but considers all pages in the list
+  for (ZPage* page = from->last(); page != nullptr;) {
+    ZPage* const prev = from->prev(page);
+    if (cl->do_page(page)) {
+      from->remove(page);
+      to->insert_last(page);
+    }
+    page = prev;
+  }
+}
 
+void ZPageCache::flush_overflushed(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   if (cl->_flushed > cl->_requested) {
     // Overflushed, re-insert part of last page into the cache
     const size_t overflushed = cl->_flushed - cl->_requested;
@@ -252,6 +295,31 @@ void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   }
 }
 
+void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
+  // Prefer flushing large, then medium and last small pages
+  flush_list(cl, &_large, to);
+  flush_per_numa_lists(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_small, to);
+  flush_overflushed(cl, to);
+}
+
+void ZPageCache::flush_any(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
+  // Prefer flushing large, then medium and last small pages
+  flush_list_any(cl, &_large, to);
+
+  ZPerNUMAIterator<ZList<ZPage> > iter_medium(&_medium);
+  for (ZList<ZPage>* list; iter_medium.next(&list);) {
+    flush_list_any(cl, list, to);
+  }
+
+  ZPerNUMAIterator<ZList<ZPage> > iter_small(&_small);
+  for (ZList<ZPage>* list; iter_small.next(&list);) {
+    flush_list_any(cl, list, to);
+  }
+
+  flush_overflushed(cl, to);
+}
+
 class ZPageCacheFlushForAllocationClosure : public ZPageCacheFlushClosure {
 public:
   ZPageCacheFlushForAllocationClosure(size_t requested)
@@ -278,16 +346,22 @@ class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
 private:
   const uint64_t _now;
   uint64_t*      _timeout;
+  size_t         _extent_size;
 
 public:
   ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t* timeout)
     : ZPageCacheFlushClosure(requested),
       _now(now),
-      _timeout(timeout) {
+      _timeout(timeout),
+      _extent_size(0) {
     // Set initial timeout
     *_timeout = ZUncommitDelay;
   }
 
+  void set_extent_size(size_t extent_size) {
+    _extent_size = extent_size;
+  }
+
   virtual bool do_page(const ZPage* page) {
     const uint64_t expires = page->last_used() + ZUncommitDelay;
     if (expires > _now) {
@@ -301,13 +375,18 @@ class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
       return false;
     }
 
+    if (_extent_size != 0 && page->physical_memory().npartial_extents(_extent_size) != 0) {
+      // Don't flush page, only whole extents requested
+      return false;
+    }
+
     // Flush page
     _flushed += page->size();
     return true;
   }
 };
 
-size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout) {
+size_t ZPageCache::flush_for_uncommit(size_t requested, size_t extent_size, ZList<ZPage>* to, uint64_t* timeout) {
   const uint64_t now = os::elapsedTime();
   const uint64_t expires = _last_commit + ZUncommitDelay;
   if (expires > now) {
@@ -323,6 +402,18 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
   }
 
   ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
+
+  if (extent_size > ZGranuleSize) {
+    // Uncommitting only part of a large page extent (e.g. a transparent
+    // huge page) splits it, and committing that memory again later will
+    // then be done using small pages. Therefore, first flush pages that
+    // cover whole extents, wherever they are in the cache, and only fall
+    // back to flushing other pages if that is not enough.
+    cl.set_extent_size(extent_size);
+    flush_any(&cl, to);
+    cl.set_extent_size(0);
+  }
+
   flush(&cl, to);
 
   return cl._flushed;
@@ -331,3 +422,7 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
 void ZPageCache::set_last_commit() {
   _last_commit = ceil(os::elapsedTime());
 }
+
+ZPageCacheNUMAStats ZPageCache::numa_stats(uint32_t numa_id) const {
+  return _numa_stats.get(numa_id);
+}
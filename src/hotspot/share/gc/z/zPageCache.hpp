@@ -31,13 +31,21 @@
 
 class ZPageCacheFlushClosure;
 
+struct ZPageCacheNUMAStats {
+  uint64_t _hit;
+  uint64_t _steal;
+  uint64_t _miss;
+};
+
 class ZPageCache {
 private:
-  ZPerNUMA<ZList<ZPage> > _small;
-  ZList<ZPage>            _medium;
-  ZList<ZPage>            _large;
-  uint64_t                _last_commit;
+  ZPerNUMA<ZList<ZPage> >       _small;
+  ZPerNUMA<ZList<ZPage> >       _medium;
+  ZList<ZPage>                  _large;
+  ZPerNUMA<ZPageCacheNUMAStats> _numa_stats;
+  uint64_t                      _last_commit;
 
+  ZPage* alloc_numa_page(ZPerNUMA<ZList<ZPage> >* lists);
   ZPage* alloc_small_page();
   ZPage* alloc_medium_page();
   ZPage* alloc_large_page(size_t size);
@@ -49,7 +57,10 @@ class ZPageCache {
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
+  void flush_list_any(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
+  void flush_overflushed(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
   void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
+  void flush_any(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
 
 public:
   ZPageCache();
@@ -58,9 +69,11 @@ class ZPageCache {
   void free_page(ZPage* page);
 
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
-  size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout);
+  size_t flush_for_uncommit(size_t requested, size_t extent_size, ZList<ZPage>* to, uint64_t* timeout);
 
   void set_last_commit();
+
+  ZPageCacheNUMAStats numa_stats(uint32_t numa_id) const;
 };
 
 #endif // SHARE_GC_Z_ZPAGECACHE_HPP
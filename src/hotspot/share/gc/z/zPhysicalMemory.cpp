@@ -74,6 +74,32 @@ size_t ZPhysicalMemory::size() const {
   return size;
 }
 
+size_t ZPhysicalMemory::npartial_extents(size_t extent_size) const {
+  assert(is_power_of_2(extent_size), "Invalid extent size");
+
+  // Count the number of extent_size aligned extents that this memory
+  // only covers part of, i.e. extents that are split at the start or
+  // at the end of a segment.
+  size_t npartial = 0;
+
+  for (int i = 0; i < _segments.length(); i++) {
+    const ZPhysicalMemorySegment& segment = _segments.at(i);
+    const uintptr_t start = untype(segment.start());
+    const uintptr_t end = untype(segment.end());
+    const bool partial_start = !is_aligned(start, extent_size);
+    const bool partial_end = !is_aligned(end, extent_size);
+
+    if (partial_start && partial_end && align_down(start, extent_size) == align_down(end - 1, extent_size)) {
+      // Segment is within a single extent
+      npartial++;
+    } else {
+      npartial += (partial_start ? 1 : 0) + (partial_end ? 1 : 0);
+    }
+  }
+
+  return npartial;
+}
+
 void ZPhysicalMemory::insert_segment(int index, zoffset start, size_t size, bool committed) {
   _segments.insert_before(index, ZPhysicalMemorySegment(start, size, committed));
 }
@@ -353,6 +379,68 @@ bool ZPhysicalMemoryManager::uncommit(ZPhysicalMemory& pmem) {
   return true;
 }
 
+bool ZPhysicalMemoryManager::is_populate_supported() const {
+  return _backing.is_populate_supported();
+}
+
+void ZPhysicalMemoryManager::commit_lazy(ZPhysicalMemory& pmem) {
+  assert(is_populate_supported(), "Not supported");
+
+  // Register segments as committed. The backing memory is allocated
+  // later, when the memory is populated after it has been mapped.
+  for (int i = 0; i < pmem.nsegments(); i++) {
+    const ZPhysicalMemorySegment& segment = pmem.segment(i);
+    if (segment.is_committed()) {
+      // Segment already committed
+      continue;
+    }
+
+    // Register with NMT
+    ZNMT::commit(segment.start(), segment.size());
+
+    // Register committed segment
+    const bool success = pmem.commit_segment(i, segment.size());
+    assert(success, "Should always succeed");
+  }
+}
+
+static zoffset physical_offset(const ZPhysicalMemory& pmem, size_t pmem_offset) {
+  for (int i = 0; i < pmem.nsegments(); i++) {
+    const ZPhysicalMemorySegment& segment = pmem.segment(i);
+    if (pmem_offset < segment.size()) {
+      return segment.start() + pmem_offset;
+    }
+
+    pmem_offset -= segment.size();
+  }
+
+  ShouldNotReachHere();
+  return zoffset(0);
+}
+
+bool ZPhysicalMemoryManager::populate(zoffset offset, const ZPhysicalMemory& pmem, size_t pmem_offset, size_t size) {
+  assert(is_aligned(pmem_offset, ZGranuleSize), "Misaligned");
+  assert(size == ZGranuleSize, "Should populate one granule at a time");
+
+  // Populate the lazily committed memory through the heap view
+  if (_backing.populate(ZOffset::address(offset), size)) {
+    // Success
+    return true;
+  }
+
+  // Failed, fall back to committing the backing memory explicitly
+  const zoffset physical = physical_offset(pmem, pmem_offset);
+  if (_backing.commit(physical, size) != size) {
+    // Failed
+    return false;
+  }
+
+  pretouch(offset, size);
+
+  // Success
+  return true;
+}
+
 void ZPhysicalMemoryManager::pretouch(zoffset offset, size_t size) const {
   const uintptr_t addr = untype(ZOffset::address(offset));
   const size_t page_size = ZLargePages::is_explicit() ? ZGranuleSize : os::vm_page_size();
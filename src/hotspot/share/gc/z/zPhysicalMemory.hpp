@@ -64,6 +64,7 @@ class ZPhysicalMemory {
 
   bool is_null() const;
   size_t size() const;
+  size_t npartial_extents(size_t extent_size) const;
 
   int nsegments() const;
   const ZPhysicalMemorySegment& segment(int index) const;
@@ -102,6 +103,10 @@ class ZPhysicalMemoryManager {
   bool commit(ZPhysicalMemory& pmem);
   bool uncommit(ZPhysicalMemory& pmem);
 
+  bool is_populate_supported() const;
+  void commit_lazy(ZPhysicalMemory& pmem);
+  bool populate(zoffset offset, const ZPhysicalMemory& pmem, size_t pmem_offset, size_t size);
+
   void pretouch(zoffset offset, size_t size) const;
 
   void map(zoffset offset, const ZPhysicalMemory& pmem) const;
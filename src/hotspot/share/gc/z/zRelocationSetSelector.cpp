@@ -27,12 +27,27 @@
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocationSetSelector.inline.hpp"
+#include "gc/z/zTask.hpp"
+#include "gc/z/zWorkers.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+// Semi-sort live pages into this many partitions
+static const size_t ZSemiSortPartitionsShift = 11;
+static const size_t ZSemiSortPartitions = (size_t)1 << ZSemiSortPartitionsShift;
+
+// Number of live pages needed before the semi-sort is done in parallel
+static const int ZSemiSortParallelThreshold = 16 * K;
+
+// Number of live pages in each chunk claimed by a parallel semi-sort worker
+static const int ZSemiSortParallelChunkSize = 4 * K;
+
 ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats()
   : _npages_candidates(0),
     _total(0),
@@ -41,20 +56,25 @@ ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats()
     _npages_selected(0),
     _relocate(0) {}
 
-ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
+ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(ZWorkers* workers,
+                                                         const char* name,
                                                          ZPageType page_type,
                                                          size_t page_size,
                                                          size_t object_size_limit,
-                                                         double fragmentation_limit)
-  : _name(name),
+                                                         double fragmentation_limit,
+                                                         bool skip_cold_pages)
+  : _workers(workers),
+    _name(name),
     _page_type(page_type),
     _page_size(page_size),
     _object_size_limit(object_size_limit),
     _fragmentation_limit(fragmentation_limit),
     _page_fragmentation_limit(page_size * (fragmentation_limit / 100)),
+    _skip_cold_pages(skip_cold_pages),
     _live_pages(),
     _not_selected_pages(),
     _forwarding_entries(0),
+    _npages_cold(0),
     _stats() {}
 
 bool ZRelocationSetSelectorGroup::is_disabled() {
@@ -67,15 +87,134 @@ bool ZRelocationSetSelectorGroup::is_selectable() {
   return _page_type != ZPageType::large;
 }
 
+class ZRelocationSetSelectorSemiSortTask : public ZTask {
+private:
+  const ZArray<ZPage*>* const _pages;
+  ZArray<ZPage*>* const       _sorted_pages;
+  const size_t                _partition_size_shift;
+  const int                   _nchunks;
+  int* const                  _partitions;
+  volatile int                _claimed;
+  bool                        _scatter;
+
+  int* chunk_partitions(int chunk) const {
+    return _partitions + (size_t)chunk * ZSemiSortPartitions;
+  }
+
+  size_t partition_index(const ZPage* page) const {
+    return page->live_bytes() >> _partition_size_shift;
+  }
+
+  void count_chunk(int chunk, int start, int end) {
+    int* const partitions = chunk_partitions(chunk);
+    for (int i = start; i < end; i++) {
+      partitions[partition_index(_pages->at(i))]++;
+    }
+  }
+
+  void scatter_chunk(int chunk, int start, int end) {
+    int* const partitions = chunk_partitions(chunk);
+    for (int i = start; i < end; i++) {
+      ZPage* const page = _pages->at(i);
+      const int finger = partitions[partition_index(page)]++;
+      assert(_sorted_pages->at(finger) == nullptr, "Invalid finger");
+      _sorted_pages->at_put(finger, page);
+    }
+  }
+
+public:
+  ZRelocationSetSelectorSemiSortTask(const ZArray<ZPage*>* pages,
+                                     ZArray<ZPage*>* sorted_pages,
+                                     size_t partition_size_shift)
+    : ZTask("ZRelocationSetSelectorSemiSortTask"),
+      _pages(pages),
+      _sorted_pages(sorted_pages),
+      _partition_size_shift(partition_size_shift),
+      _nchunks(align_up(pages->length(), ZSemiSortParallelChunkSize) / ZSemiSortParallelChunkSize),
+      _partitions(NEW_C_HEAP_ARRAY(int, (size_t)_nchunks * ZSemiSortPartitions, mtGC)),
+      _claimed(0),
+      _scatter(false) {
+    memset(_partitions, 0, (size_t)_nchunks * ZSemiSortPartitions * sizeof(int));
+  }
+
+  ~ZRelocationSetSelectorSemiSortTask() {
+    FREE_C_HEAP_ARRAY(int, _partitions);
+  }
+
+  // Convert the per-chunk partition slots into per-chunk partition
+  // fingers. Chunks are laid out in order within each partition, which
+  // makes the result identical to that of a serial semi-sort.
+  void calculate_fingers() {
+    int finger = 0;
+    for (size_t i = 0; i < ZSemiSortPartitions; i++) {
+      for (int chunk = 0; chunk < _nchunks; chunk++) {
+        int* const partitions = chunk_partitions(chunk);
+        const int slots = partitions[i];
+        partitions[i] = finger;
+        finger += slots;
+      }
+    }
+
+    assert(finger == _pages->length(), "Invalid number of pages");
+
+    // Prepare for scatter
+    _claimed = 0;
+    _scatter = true;
+  }
+
+  virtual void work() {
+    const int npages = _pages->length();
+
+    for (int chunk; (chunk = Atomic::fetch_then_add(&_claimed, 1)) < _nchunks;) {
+      const int start = chunk * ZSemiSortParallelChunkSize;
+      const int end = MIN2(start + ZSemiSortParallelChunkSize, npages);
+
+      if (_scatter) {
+        scatter_chunk(chunk, start, end);
+      } else {
+        count_chunk(chunk, start, end);
+      }
+    }
+  }
+};
+
+bool ZRelocationSetSelectorGroup::should_semi_sort_parallel() const {
+  return _workers != nullptr &&
+         _workers->active_workers() > 1 &&
+         _live_pages.length() >= ZSemiSortParallelThreshold;
+}
+
+void ZRelocationSetSelectorGroup::semi_sort_parallel(size_t partition_size_shift) {
+  // Allocate destination array
+  const int npages = _live_pages.length();
+  ZArray<ZPage*> sorted_live_pages(npages, npages, nullptr);
+
+  ZRelocationSetSelectorSemiSortTask task(&_live_pages, &sorted_live_pages, partition_size_shift);
+
+  // Calculate per-chunk partition slots
+  _workers->run(&task);
+
+  // Merge into per-chunk partition fingers
+  task.calculate_fingers();
+
+  // Sort pages into partitions
+  _workers->run(&task);
+
+  _live_pages.swap(&sorted_live_pages);
+}
+
 void ZRelocationSetSelectorGroup::semi_sort() {
   // Semi-sort live pages by number of live bytes in ascending order
-  const size_t npartitions_shift = 11;
-  const size_t npartitions = (size_t)1 << npartitions_shift;
-  const size_t partition_size = _page_size >> npartitions_shift;
+  const size_t partition_size = _page_size >> ZSemiSortPartitionsShift;
   const size_t partition_size_shift = exact_log2(partition_size);
 
+  if (should_semi_sort_parallel()) {
+    semi_sort_parallel(partition_size_shift);
+    return;
+  }
+
   // Partition slots/fingers
-  int partitions[npartitions] = { /* zero initialize */ };
+  int partitions[ZSemiSortPartitions] = { /* zero initialize */ };
 
   // Calculate partition slots
   ZArrayIterator<ZPage*> iter1(&_live_pages);
@@ -86,7 +225,7 @@ void ZRelocationSetSelectorGroup::semi_sort() {
 
   // Calculate partition fingers
   int finger = 0;
-  for (size_t i = 0; i < npartitions; i++) {
+  for (size_t i = 0; i < ZSemiSortPartitions; i++) {
     const int slots = partitions[i];
     partitions[i] = finger;
     finger += slots;
@@ -175,8 +314,8 @@ void ZRelocationSetSelectorGroup::select_inner() {
     _stats[i]._npages_selected = npages_selected[i];
   }
 
-  log_debug(gc, reloc)("Relocation Set (%s Pages): %d->%d, %d skipped, " SIZE_FORMAT " forwarding entries",
-                       _name, selected_from, selected_to, npages - selected_from, selected_forwarding_entries);
+  log_debug(gc, reloc)("Relocation Set (%s Pages): %d->%d, %d skipped, %d cold, " SIZE_FORMAT " forwarding entries",
+                       _name, selected_from, selected_to, npages - selected_from, _npages_cold, selected_forwarding_entries);
 }
 
 void ZRelocationSetSelectorGroup::select() {
@@ -210,10 +349,10 @@ void ZRelocationSetSelectorGroup::select() {
   event.commit((u8)_page_type, s._npages_candidates, s._total, s._empty, s._npages_selected, s._relocate);
 }
 
-ZRelocationSetSelector::ZRelocationSetSelector(double fragmentation_limit)
-  : _small("Small", ZPageType::small, ZPageSizeSmall, ZObjectSizeLimitSmall, fragmentation_limit),
-    _medium("Medium", ZPageType::medium, ZPageSizeMedium, ZObjectSizeLimitMedium, fragmentation_limit),
-    _large("Large", ZPageType::large, 0 /* page_size */, 0 /* object_size_limit */, fragmentation_limit),
+ZRelocationSetSelector::ZRelocationSetSelector(ZWorkers* workers, double fragmentation_limit, bool skip_cold_pages)
+  : _small(workers, "Small", ZPageType::small, ZPageSizeSmall, ZObjectSizeLimitSmall, fragmentation_limit, skip_cold_pages),
+    _medium(workers, "Medium", ZPageType::medium, ZPageSizeMedium, ZObjectSizeLimitMedium, fragmentation_limit, skip_cold_pages),
+    _large(workers, "Large", ZPageType::large, 0 /* page_size */, 0 /* object_size_limit */, fragmentation_limit, skip_cold_pages),
     _empty_pages() {}
 
 void ZRelocationSetSelector::select() {
@@ -31,6 +31,7 @@
 #include "memory/allocation.hpp"
 
 class ZPage;
+class ZWorkers;
 
 class ZRelocationSetSelectorGroupStats {
   friend class ZRelocationSetSelectorGroup;
@@ -78,28 +79,35 @@ class ZRelocationSetSelectorStats {
 
 class ZRelocationSetSelectorGroup {
 private:
+  ZWorkers* const                  _workers;
   const char* const                _name;
   const ZPageType                  _page_type;
   const size_t                     _page_size;
   const size_t                     _object_size_limit;
   const double                     _fragmentation_limit;
   const size_t                     _page_fragmentation_limit;
+  const bool                       _skip_cold_pages;
   ZArray<ZPage*>                   _live_pages;
   ZArray<ZPage*>                   _not_selected_pages;
   size_t                           _forwarding_entries;
+  int                              _npages_cold;
   ZRelocationSetSelectorGroupStats _stats[ZPageAgeMax + 1];
 
   bool is_disabled();
   bool is_selectable();
+  bool should_semi_sort_parallel() const;
+  void semi_sort_parallel(size_t partition_size_shift);
   void semi_sort();
   void select_inner();
 
 public:
-  ZRelocationSetSelectorGroup(const char* name,
+  ZRelocationSetSelectorGroup(ZWorkers* workers,
+                              const char* name,
                               ZPageType page_type,
                               size_t page_size,
                               size_t object_size_limit,
-                              double fragmentation_limit);
+                              double fragmentation_limit,
+                              bool skip_cold_pages);
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
@@ -125,7 +133,7 @@ class ZRelocationSetSelector : public StackObj {
   size_t relocate() const;
 
 public:
-  ZRelocationSetSelector(double fragmentation_limit);
+  ZRelocationSetSelector(ZWorkers* workers, double fragmentation_limit, bool skip_cold_pages);
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
@@ -76,7 +76,13 @@ inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
 
   // Pre-filter out pages that are guaranteed to not be selected
   if (!page->is_large() && garbage > _page_fragmentation_limit) {
-    _live_pages.append(page);
+    if (_skip_cold_pages && page->is_old() && page->is_cold()) {
+      // Cold old pages are left in place, relocating them would
+      // only spend bandwidth on objects that are rarely accessed
+      _npages_cold++;
+    } else {
+      _live_pages.append(page);
+    }
   } else if (page->is_young()) {
     _not_selected_pages.append(page);
   }
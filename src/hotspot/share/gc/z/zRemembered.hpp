@@ -84,6 +84,9 @@ class ZRemembered {
   // Add to remembered set
   void remember(volatile zpointer* p) const;
 
+  // Add remembered set entries for a sorted array of old fields
+  void remember(volatile zpointer* const* p, size_t count) const;
+
   // Scan all remembered sets and follow
   void scan_and_follow(ZMark* mark);
 
@@ -37,6 +37,24 @@ inline void ZRemembered::remember(volatile zpointer* p) const {
   page->remember(p);
 }
 
+inline void ZRemembered::remember(volatile zpointer* const* p, size_t count) const {
+  size_t i = 0;
+
+  while (i < count) {
+    // Group fields on the same page
+    ZPage* const page = _page_table->get(p[i]);
+    assert(page != nullptr,  "Page missing in page table");
+
+    size_t j = i + 1;
+    while (j < count && _page_table->get(p[j]) == page) {
+      j++;
+    }
+
+    page->remember(p + i, j - i);
+    i = j;
+  }
+}
+
 inline bool ZRemembered::is_remembered(volatile zpointer* p) const {
   ZPage* page = _page_table->get(p);
   assert(page != nullptr,  "Page missing in page table");
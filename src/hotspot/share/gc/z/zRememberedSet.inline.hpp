@@ -26,6 +26,7 @@
 
 #include "gc/z/zRememberedSet.hpp"
 
+#include "gc/z/zBitMap.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 inline CHeapBitMap* ZRememberedSet::current() {
@@ -73,6 +74,13 @@ inline bool ZRememberedSet::set_current(uintptr_t offset) {
   return current()->par_set_bit(index, memory_order_relaxed);
 }
 
+template <typename Function>
+inline void ZRememberedSet::set_current(size_t count, Function offset_at) {
+  _bitmap[_current].par_set_sorted_bits(count, [&](size_t i) {
+    return to_index(offset_at(i));
+  });
+}
+
 inline void ZRememberedSet::unset_non_par_current(uintptr_t offset) {
   const BitMap::idx_t index = to_index(offset);
   current()->clear_bit(index);
@@ -30,12 +30,15 @@
 #include "gc/z/zCPU.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zHeap.hpp"
 #include "gc/z/zNMethodTable.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTracer.inline.hpp"
 #include "gc/z/zUtils.hpp"
+#include "gc/z/zValue.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
@@ -725,6 +728,7 @@ void ZStatPhaseGeneration::register_end(ConcurrentGCTimer* timer, const Ticks& s
   generation->stat_heap()->print_stalls();
   ZStatLoad::print();
   ZStatMMU::print();
+  ZStatPageCache::print();
   generation->stat_mark()->print();
   ZStatNMethods::print();
   ZStatMetaspace::print();
@@ -936,11 +940,23 @@ volatile size_t ZStatMutatorAllocRate::_allocated_since_sample;
 TruncatedSeq    ZStatMutatorAllocRate::_samples_time(100);
 TruncatedSeq    ZStatMutatorAllocRate::_samples_bytes(100);
 TruncatedSeq    ZStatMutatorAllocRate::_rate(100);
+ZPerCPU<size_t>* ZStatMutatorAllocRate::_cpu_allocated;
+size_t*          ZStatMutatorAllocRate::_cpu_sampled;
+jlong            ZStatMutatorAllocRate::_short_last_sample_time;
+TruncatedSeq     ZStatMutatorAllocRate::_short_rate(10);
+uint             ZStatMutatorAllocRate::_short_active_cpus;
 
 void ZStatMutatorAllocRate::initialize() {
   _last_sample_time = os::elapsed_counter();
   _stat_lock = new ZLock();
   update_sampling_granule();
+
+  _cpu_allocated = new ZPerCPU<size_t>(0);
+  _cpu_sampled = NEW_C_HEAP_ARRAY(size_t, ZCPU::count(), mtGC);
+  for (uint32_t i = 0; i < ZCPU::count(); i++) {
+    _cpu_sampled[i] = 0;
+  }
+  _short_last_sample_time = _last_sample_time;
 }
 
 void ZStatMutatorAllocRate::update_sampling_granule() {
@@ -950,6 +966,9 @@ void ZStatMutatorAllocRate::update_sampling_granule() {
 }
 
 void ZStatMutatorAllocRate::sample_allocation(size_t allocation_bytes) {
+  // Per CPU allocation, used for the short horizon allocation rate
+  Atomic::add(_cpu_allocated->addr(), allocation_bytes, memory_order_relaxed);
+
   const size_t allocated = Atomic::add(&_allocated_since_sample, allocation_bytes);
 
   if (allocated < Atomic::load(&_sampling_granule)) {
@@ -1006,9 +1025,44 @@ void ZStatMutatorAllocRate::sample_allocation(size_t allocation_bytes) {
   ZDirector::evaluate_rules();
 }
 
+void ZStatMutatorAllocRate::sample_short_horizon() {
+  // The long-term allocation rate is only sampled every time a fraction of
+  // the heap has been allocated, which makes it slow to react to bursts of
+  // allocations. The short horizon allocation rate is sampled by the director
+  // on every tick, from the bytes allocated on each CPU since the last tick.
+  ZLocker<ZLock> locker(_stat_lock);
+
+  const jlong now = os::elapsed_counter();
+  const jlong elapsed = now - _short_last_sample_time;
+
+  if (elapsed <= 0) {
+    // Avoid sampling nonsense allocation rates
+    return;
+  }
+
+  size_t allocated = 0;
+  uint active_cpus = 0;
+
+  for (uint32_t i = 0; i < ZCPU::count(); i++) {
+    const size_t cpu_allocated = Atomic::load(_cpu_allocated->addr(i));
+    const size_t cpu_sample = cpu_allocated - _cpu_sampled[i];
+    _cpu_sampled[i] = cpu_allocated;
+
+    if (cpu_sample > 0) {
+      allocated += cpu_sample;
+      active_cpus++;
+    }
+  }
+
+  const double elapsed_seconds = double(elapsed) / os::elapsed_frequency();
+  _short_rate.add(double(allocated) / elapsed_seconds);
+  _short_active_cpus = active_cpus;
+  _short_last_sample_time = now;
+}
+
 ZStatMutatorAllocRateStats ZStatMutatorAllocRate::stats() {
   ZLocker<ZLock> locker(_stat_lock);
-  return {_rate.avg(), _rate.predict_next(), _rate.sd()};
+  return {_rate.avg(), _rate.predict_next(), _rate.sd(), _short_rate.avg(), _short_rate.sd(), _short_active_cpus};
 }
 
 //
@@ -1411,6 +1465,28 @@ void ZStatLoad::print() {
                      loadavg[2], percent_of(loadavg[2], (double) ZCPU::count()));
 }
 
+//
+// Stat page cache
+//
+void ZStatPageCache::print() {
+  if (!ZNUMA::is_enabled()) {
+    // Only interesting with multiple NUMA nodes
+    return;
+  }
+
+  for (uint32_t numa_id = 0; numa_id < ZNUMA::count(); numa_id++) {
+    const ZPageCacheNUMAStats stats = ZHeap::heap()->page_cache_numa_stats(numa_id);
+    log_info(gc, heap)("Page Cache NUMA Node %u: "
+                       UINT64_FORMAT " hit(s), "
+                       UINT64_FORMAT " steal(s), "
+                       UINT64_FORMAT " miss(es)",
+                       numa_id,
+                       stats._hit,
+                       stats._steal,
+                       stats._miss);
+  }
+}
+
 //
 // Stat mark
 //
@@ -1420,6 +1496,10 @@ ZStatMark::ZStatMark()
     _nterminateflush(),
     _ntrycomplete(),
     _ncontinue(),
+    _nstealattempts(),
+    _nsteals(),
+    _nstealcontended(),
+    _nstripesgrow(),
     _mark_stack_usage() {}
 
 void ZStatMark::at_mark_start(size_t nstripes) {
@@ -1429,11 +1509,19 @@ void ZStatMark::at_mark_start(size_t nstripes) {
 void ZStatMark::at_mark_end(size_t nproactiveflush,
                             size_t nterminateflush,
                             size_t ntrycomplete,
-                            size_t ncontinue) {
+                            size_t ncontinue,
+                            size_t nstealattempts,
+                            size_t nsteals,
+                            size_t nstealcontended,
+                            size_t nstripesgrow) {
   _nproactiveflush = nproactiveflush;
   _nterminateflush = nterminateflush;
   _ntrycomplete = ntrycomplete;
   _ncontinue = ncontinue;
+  _nstealattempts = nstealattempts;
+  _nsteals = nsteals;
+  _nstealcontended = nstealcontended;
+  _nstripesgrow = nstripesgrow;
 }
 
 void ZStatMark::at_mark_free(size_t mark_stack_usage) {
@@ -1453,6 +1541,16 @@ void ZStatMark::print() {
                         _ntrycomplete,
                         _ncontinue);
 
+  log_info(gc, marking)("Mark Steal: "
+                        SIZE_FORMAT " attempt(s), "
+                        SIZE_FORMAT " success(es), "
+                        SIZE_FORMAT " contended, "
+                        SIZE_FORMAT " stripe increase(s)",
+                        _nstealattempts,
+                        _nsteals,
+                        _nstealcontended,
+                        _nstripesgrow);
+
   log_info(gc, marking)("Mark Stack Usage: " SIZE_FORMAT "M", _mark_stack_usage / M);
 }
 
@@ -32,6 +32,7 @@
 #include "gc/z/zRelocationSetSelector.hpp"
 #include "gc/z/zThread.hpp"
 #include "gc/z/zTracer.hpp"
+#include "gc/z/zValue.hpp"
 #include "logging/logHandle.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -352,6 +353,11 @@ struct ZStatMutatorAllocRateStats {
   double _avg;
   double _predict;
   double _sd;
+
+  // Short horizon, sampled per CPU
+  double _short_avg;
+  double _short_sd;
+  uint   _short_active_cpus;
 };
 
 //
@@ -367,11 +373,19 @@ class ZStatMutatorAllocRate : public AllStatic {
   static TruncatedSeq    _samples_bytes;
   static TruncatedSeq    _rate;
 
+  // Short horizon allocation rate
+  static ZPerCPU<size_t>* _cpu_allocated;
+  static size_t*          _cpu_sampled;
+  static jlong            _short_last_sample_time;
+  static TruncatedSeq     _short_rate;
+  static uint             _short_active_cpus;
+
   static void update_sampling_granule();
 
 public:
   static const ZStatUnsampledCounter& counter();
   static void sample_allocation(size_t allocation_bytes);
+  static void sample_short_horizon();
 
   static void initialize();
 
@@ -485,6 +499,14 @@ class ZStatLoad : public AllStatic {
   static void print();
 };
 
+//
+// Stat page cache
+//
+class ZStatPageCache : public AllStatic {
+public:
+  static void print();
+};
+
 //
 // Stat mark
 //
@@ -495,6 +517,10 @@ class ZStatMark {
   size_t _nterminateflush;
   size_t _ntrycomplete;
   size_t _ncontinue;
+  size_t _nstealattempts;
+  size_t _nsteals;
+  size_t _nstealcontended;
+  size_t _nstripesgrow;
   size_t _mark_stack_usage;
 
 public:
@@ -504,7 +530,11 @@ class ZStatMark {
   void at_mark_end(size_t nproactiveflush,
                    size_t nterminateflush,
                    size_t ntrycomplete,
-                   size_t ncontinue);
+                   size_t ncontinue,
+                   size_t nstealattempts,
+                   size_t nsteals,
+                   size_t nstealcontended,
+                   size_t nstripesgrow);
   void at_mark_free(size_t mark_stack_usage);
 
   void print();
@@ -268,6 +268,28 @@ void ZStoreBarrierBuffer::on_error(outputStream* st) {
   }
 }
 
+static size_t sort_and_deduplicate(volatile zpointer** fields, size_t count) {
+  // Insertion sort, the number of fields is small
+  for (size_t i = 1; i < count; i++) {
+    volatile zpointer* const field = fields[i];
+    size_t j = i;
+    for (; j > 0 && fields[j - 1] > field; j--) {
+      fields[j] = fields[j - 1];
+    }
+    fields[j] = field;
+  }
+
+  // Remove duplicates
+  size_t unique = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (unique == 0 || fields[unique - 1] != fields[i]) {
+      fields[unique++] = fields[i];
+    }
+  }
+
+  return unique;
+}
+
 void ZStoreBarrierBuffer::flush() {
   if (!ZBufferStoreBarriers) {
     return;
@@ -276,12 +298,28 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
+  volatile zpointer* remembered[_buffer_length];
+  size_t nremembered = 0;
+
+  // Mark previous values and collect old fields
   for (int i = current(); i < (int)_buffer_length; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
+
+    if (ZHeap::heap()->is_old(entry._p)) {
+      remembered[nremembered++] = entry._p;
+    }
   }
 
+  // Add remembered set entries. The same fields are often stored to
+  // repeatedly, and neighbouring fields share remembered set words, so
+  // sort the fields to set the remembered bits one word at a time.
+  nremembered = sort_and_deduplicate(remembered, nremembered);
+  ZGeneration::young()->remember(remembered, nremembered);
+
   clear();
 }
 
@@ -34,16 +34,16 @@
 
 class ZThreadLocalData {
 private:
-  uintptr_t              _load_good_mask;
-  uintptr_t              _load_bad_mask;
-  uintptr_t              _mark_bad_mask;
-  uintptr_t              _store_good_mask;
-  uintptr_t              _store_bad_mask;
-  uintptr_t              _uncolor_mask;
-  uintptr_t              _nmethod_disarmed;
-  ZStoreBarrierBuffer*   _store_barrier_buffer;
-  ZMarkThreadLocalStacks _mark_stacks[2];
-  zaddress_unsafe*       _invisible_root;
+  uintptr_t               _load_good_mask;
+  uintptr_t               _load_bad_mask;
+  uintptr_t               _mark_bad_mask;
+  uintptr_t               _store_good_mask;
+  uintptr_t               _store_bad_mask;
+  uintptr_t               _uncolor_mask;
+  uintptr_t               _nmethod_disarmed;
+  ZStoreBarrierBuffer*    _store_barrier_buffer;
+  ZMarkThreadLocalStacks* _mark_stacks[2];
+  zaddress_unsafe*        _invisible_root;
 
   ZThreadLocalData()
     : _load_good_mask(0),
@@ -54,11 +54,13 @@ class ZThreadLocalData {
       _uncolor_mask(0),
       _nmethod_disarmed(0),
       _store_barrier_buffer(new ZStoreBarrierBuffer()),
-      _mark_stacks(),
+      _mark_stacks{new ZMarkThreadLocalStacks(), new ZMarkThreadLocalStacks()},
       _invisible_root(nullptr) {}
 
   ~ZThreadLocalData() {
     delete _store_barrier_buffer;
+    delete _mark_stacks[0];
+    delete _mark_stacks[1];
   }
 
   static ZThreadLocalData* data(Thread* thread) {
@@ -99,7 +101,7 @@ class ZThreadLocalData {
   }
 
   static ZMarkThreadLocalStacks* mark_stacks(Thread* thread, ZGenerationId id) {
-    return &data(thread)->_mark_stacks[(int)id];
+    return data(thread)->_mark_stacks[(int)id];
   }
 
   static ZStoreBarrierBuffer* store_barrier_buffer(Thread* thread) {
@@ -158,6 +158,42 @@ void ZTracer::send_thread_phase(const char* name, const Ticks& start, const Tick
   }
 }
 
+void ZTracer::send_mark_stripe_rebalance(size_t old_nstripes, size_t new_nstripes, size_t nattempts, size_t nsteals, size_t ncontended) {
+  NoSafepointVerifier nsv;
+
+  EventZMarkStripeRebalance e;
+  if (e.should_commit()) {
+    e.set_gcId(GCId::current_or_undefined());
+    e.set_oldStripes(old_nstripes);
+    e.set_newStripes(new_nstripes);
+    e.set_stealAttempts(nattempts);
+    e.set_steals(nsteals);
+    e.set_contended(ncontended);
+    e.commit();
+  }
+}
+
+void ZTracer::send_minor_allocation_rate(const char* rule, const ZStatMutatorAllocRateStats& stats, double alloc_rate, size_t free, double time_until_gc, uint gc_workers, bool triggered) {
+  NoSafepointVerifier nsv;
+
+  EventZAllocationRateDecision e;
+  if (e.should_commit()) {
+    e.set_rule(rule);
+    e.set_allocationRate(alloc_rate);
+    e.set_averageRate(stats._avg);
+    e.set_predictedRate(stats._predict);
+    e.set_rateDeviation(stats._sd);
+    e.set_shortAverageRate(stats._short_avg);
+    e.set_shortRateDeviation(stats._short_sd);
+    e.set_activeCPUs(stats._short_active_cpus);
+    e.set_free(free);
+    e.set_timeUntilGC(time_until_gc);
+    e.set_gcWorkers(gc_workers);
+    e.set_triggered(triggered);
+    e.commit();
+  }
+}
+
 void ZTracer::send_thread_debug(const char* name, const Ticks& start, const Ticks& end) {
   NoSafepointVerifier nsv;
 
@@ -30,6 +30,7 @@
 class ZStatCounter;
 class ZStatPhase;
 class ZStatSampler;
+struct ZStatMutatorAllocRateStats;
 
 class ZTracer : AllStatic {
 private:
@@ -37,6 +38,8 @@ class ZTracer : AllStatic {
   static void send_stat_sampler(const ZStatSampler& sampler, uint64_t value);
   static void send_thread_phase(const char* name, const Ticks& start, const Ticks& end);
   static void send_thread_debug(const char* name, const Ticks& start, const Ticks& end);
+  static void send_mark_stripe_rebalance(size_t old_nstripes, size_t new_nstripes, size_t nattempts, size_t nsteals, size_t ncontended);
+  static void send_minor_allocation_rate(const char* rule, const ZStatMutatorAllocRateStats& stats, double alloc_rate, size_t free, double time_until_gc, uint gc_workers, bool triggered);
 
 public:
   static void initialize();
@@ -45,6 +48,8 @@ class ZTracer : AllStatic {
   static void report_stat_sampler(const ZStatSampler& sampler, uint64_t value);
   static void report_thread_phase(const char* name, const Ticks& start, const Ticks& end);
   static void report_thread_debug(const char* name, const Ticks& start, const Ticks& end);
+  static void report_mark_stripe_rebalance(size_t old_nstripes, size_t new_nstripes, size_t nattempts, size_t nsteals, size_t ncontended);
+  static void report_minor_allocation_rate(const char* rule, const ZStatMutatorAllocRateStats& stats, double alloc_rate, size_t free, double time_until_gc, uint gc_workers, bool triggered);
 };
 
 class ZMinorTracer : public GCTracer {
@@ -52,6 +52,18 @@ inline void ZTracer::report_thread_debug(const char* name, const Ticks& start, c
   }
 }
 
+inline void ZTracer::report_mark_stripe_rebalance(size_t old_nstripes, size_t new_nstripes, size_t nattempts, size_t nsteals, size_t ncontended) {
+  if (EventZMarkStripeRebalance::is_enabled()) {
+    send_mark_stripe_rebalance(old_nstripes, new_nstripes, nattempts, nsteals, ncontended);
+  }
+}
+
+inline void ZTracer::report_minor_allocation_rate(const char* rule, const ZStatMutatorAllocRateStats& stats, double alloc_rate, size_t free, double time_until_gc, uint gc_workers, bool triggered) {
+  if (EventZAllocationRateDecision::is_enabled()) {
+    send_minor_allocation_rate(rule, stats, alloc_rate, free, time_until_gc, gc_workers, triggered);
+  }
+}
+
 inline ZTraceThreadDebug::ZTraceThreadDebug(const char* name)
   : _start(Ticks::now()),
     _name(name) {}
@@ -47,9 +47,30 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(bool, ZMarkPrefetch, false,                                       \
+          "Prefetch objects popped from the mark stack before marking "     \
+          "and following them")                                             \
+                                                                            \
+  product(bool, ZPageHeatTracking, false, EXPERIMENTAL,                     \
+          "Track load barrier slow path hits on old pages and leave cold "  \
+          "old pages out of the relocation set when there is headroom")     \
+                                                                            \
+  product(double, ZPageHeatHeadroom, 25.0, EXPERIMENTAL,                    \
+          "Percentage of free memory, relative to the soft max capacity, "  \
+          "needed to leave cold old pages out of the relocation set")       \
+          range(0, 100)                                                     \
+                                                                            \
+  product(bool, ZShortHorizonAllocationRate, true, DIAGNOSTIC,              \
+          "Use the short horizon allocation rate, sampled per CPU, when "   \
+          "predicting when to start a minor collection")                    \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
+  product(bool, ZNUMAPageCacheSteal, true, DIAGNOSTIC,                      \
+          "Allow page allocations to be satisfied from pages cached on "    \
+          "remote NUMA nodes, before committing new NUMA local memory")     \
+                                                                            \
   product(uint, ZYoungGCThreads, 0, DIAGNOSTIC,                             \
           "Number of GC threads for the young generation")                  \
                                                                             \
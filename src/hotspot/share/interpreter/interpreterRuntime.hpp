@@ -91,6 +91,11 @@ class InterpreterRuntime: AllStatic {
   static void    throw_pending_exception(JavaThread* current);
 
   static void resolve_from_cache(JavaThread* current, Bytecodes::Code bytecode);
+
+  // Resolve the field reference at field_index for bytecode in method m. Also
+  // used to prelink field references when dumping the CDS archive.
+  static void resolve_get_put(Bytecodes::Code bytecode, int field_index,
+                              const methodHandle& m, const constantPoolHandle& pool, TRAPS);
  private:
   // Statics & fields
   static void resolve_get_put(JavaThread* current, Bytecodes::Code bytecode);
@@ -443,7 +443,7 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
 
-OopMapCache::OopMapCache() {
+OopMapCache::OopMapCache() : _size((int)OopMapCacheSize) {
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = nullptr;
 }
@@ -35,43 +35,59 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+// One throttler instance per event type with throttle="true" in metadata.xml.
+// Throttlers other than the one for jdk.ObjectAllocationSample start out
+// disabled, i.e. accepting every event, until a throttle rate is configured.
+static const int _num_throttlers = 3;
+static JfrEventThrottler* _throttlers[_num_throttlers] = { nullptr };
 
-JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
+JfrEventThrottler::JfrEventThrottler(JfrEventId event_id, const char* event_name, bool disabled) :
   JfrAdaptiveSampler(),
   _last_params(),
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
   _event_id(event_id),
-  _disabled(false),
+  _event_name(event_name),
+  _disabled(disabled),
   _update(false) {}
 
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  assert(_throttlers[0] == nullptr, "invariant");
+  _throttlers[0] = new JfrEventThrottler(JfrObjectAllocationSampleEvent, "jdk.ObjectAllocationSample", false);
+  _throttlers[1] = new JfrEventThrottler(JfrJavaMonitorEnterEvent, "jdk.JavaMonitorEnter", true);
+  _throttlers[2] = new JfrEventThrottler(JfrThreadParkEvent, "jdk.ThreadPark", true);
+  for (int i = 0; i < _num_throttlers; i++) {
+    if (_throttlers[i] == nullptr || !_throttlers[i]->initialize()) {
+      return false;
+    }
+  }
+  return true;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+  for (int i = 0; i < _num_throttlers; i++) {
+    delete _throttlers[i];
+    _throttlers[i] = nullptr;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+  for (int i = 0; i < _num_throttlers; i++) {
+    assert(_throttlers[i] != nullptr, "JfrEventThrottler has not been properly initialized");
+    if (_throttlers[i]->_event_id == event_id) {
+      return _throttlers[i];
+    }
+  }
+  return nullptr;
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  JfrEventThrottler* const throttler = for_event(event_id);
+  if (throttler == nullptr) {
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  throttler->configure(sample_size, period_ms);
 }
 
 /*
@@ -93,8 +109,9 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 // Predicate for event selection.
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
+  assert(throttler != nullptr, "Event type has an unconfigured throttler");
   if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -240,16 +257,13 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
- *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(const char* event_name, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(static_cast<double>(expired->sample_size()), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("%s: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      event_name, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : static_cast<double>(expired->sample_size()) / static_cast<double>(expired->population_size()),
       expired->params().window_duration_ms);
   }
@@ -268,7 +282,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_name, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
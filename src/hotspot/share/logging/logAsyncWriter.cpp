@@ -81,8 +81,12 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The AsyncLog thread only waits while no data is available, so only
+  // the first message after it has swapped buffers needs to wake it up.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
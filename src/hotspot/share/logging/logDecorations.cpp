@@ -90,16 +90,40 @@ const char* LogDecorations::decoration(LogDecorators::Decorator decorator, char*
   return buf;
 }
 
+// Formatting a timestamp converts it to local or UTC time, which is costly.
+// Timestamps of log lines printed by a thread within the same second only
+// differ in their milliseconds, so each thread keeps the last timestamp it
+// formatted and only patches the milliseconds for the following ones.
+static THREAD_LOCAL jlong _cached_time_seconds[2] = { -1, -1 };
+static THREAD_LOCAL char _cached_time[2][os::iso8601_timestamp_size];
+
+static const char* iso8601_time(jlong millis, bool utc) {
+  // Offset of "mmm" in "YYYY-MM-DDThh:mm:ss.mmm+zzzz"
+  const size_t millis_offset = 20;
+  const int i = utc ? 1 : 0;
+  const jlong seconds = millis / MILLIUNITS;
+  char* const buf = _cached_time[i];
+  if (seconds != _cached_time_seconds[i] || millis < 0 || buf[millis_offset - 1] != '.') {
+    if (os::iso8601_time(millis, buf, sizeof(_cached_time[i]), utc) == nullptr) {
+      _cached_time_seconds[i] = -1;
+      return "";
+    }
+    _cached_time_seconds[i] = seconds;
+  } else {
+    const int ms = (int)(millis % MILLIUNITS);
+    buf[millis_offset]     = (char)('0' + ms / 100);
+    buf[millis_offset + 1] = (char)('0' + (ms / 10) % 10);
+    buf[millis_offset + 2] = (char)('0' + ms % 10);
+  }
+  return buf;
+}
+
 void LogDecorations::print_time_decoration(outputStream* st) const {
-  char buf[os::iso8601_timestamp_size];
-  char* result = os::iso8601_time(_millis, buf, sizeof(buf), false);
-  st->print_raw(result ? result : "");
+  st->print_raw(iso8601_time(_millis, false));
 }
 
 void LogDecorations::print_utctime_decoration(outputStream* st) const {
-  char buf[os::iso8601_timestamp_size];
-  char* result = os::iso8601_time(_millis, buf, sizeof(buf), true);
-  st->print_raw(result ? result : "");
+  st->print_raw(iso8601_time(_millis, true));
 }
 
 void LogDecorations::print_uptime_decoration(outputStream* st) const {
@@ -52,8 +52,16 @@ class ChunkPool {
   static constexpr int _num_pools = 4;
   static ChunkPool _pools[_num_pools];
 
+  // Pools for the large size classes, used with PoolLargeArenaChunks.
+  // Each holds at most a few chunks, since a cached chunk can be large.
+  static constexpr int _num_large_pools = 7;
+  static constexpr size_t _max_large_pool_chunks = 2;
+  static ChunkPool _large_pools[_num_large_pools];
+
   Chunk*       _first;
   const size_t _size;         // (inner payload) size of the chunks this pool serves
+  const size_t _max_chunks;   // maximum number of pooled chunks, 0 if unbounded
+  size_t       _num_chunks;
 
   // Returns null if pool is empty.
   Chunk* take_from_pool() {
@@ -61,14 +69,21 @@ class ChunkPool {
     Chunk* c = _first;
     if (_first != nullptr) {
       _first = _first->next();
+      _num_chunks--;
     }
     return c;
   }
-  void return_to_pool(Chunk* chunk) {
+  // Returns false if the pool is full.
+  bool return_to_pool(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
     ThreadCritical tc;
+    if (_max_chunks > 0 && _num_chunks >= _max_chunks) {
+      return false;
+    }
     chunk->set_next(_first);
     _first = chunk;
+    _num_chunks++;
+    return true;
   }
 
   // Clear this pool of all contained chunks
@@ -84,6 +99,7 @@ class ChunkPool {
       cur = next;
     }
     _first = nullptr;
+    _num_chunks = 0;
   }
 
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
@@ -93,17 +109,39 @@ class ChunkPool {
         return _pools + i;
       }
     }
+    if (PoolLargeArenaChunks) {
+      for (int i = 0; i < _num_large_pools; i++) {
+        if (_large_pools[i]._size == size) {
+          return _large_pools + i;
+        }
+      }
+    }
     return nullptr;
   }
 
 public:
-  ChunkPool(size_t size) : _first(nullptr), _size(size) {}
+  ChunkPool(size_t size, size_t max_chunks = 0) :
+    _first(nullptr), _size(size), _max_chunks(max_chunks), _num_chunks(0) {}
 
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
     for (int i = 0; i < _num_pools; i++) {
       _pools[i].prune();
     }
+    for (int i = 0; i < _num_large_pools; i++) {
+      _large_pools[i].prune();
+    }
+  }
+
+  // Returns the payload size of the large size class that can hold length
+  // bytes, or length itself if it is beyond the largest class.
+  static size_t large_size_class(size_t length) {
+    for (int i = 0; i < _num_large_pools; i++) {
+      if (length <= _large_pools[i]._size) {
+        return _large_pools[i]._size;
+      }
+    }
+    return length;
   }
 
   // Returns an initialized and null-terminated Chunk of requested size
@@ -158,11 +196,9 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
 }
 
 void ChunkPool::deallocate_chunk(Chunk* c) {
-  // If this is a standard-sized chunk, return it to its pool; otherwise free it.
+  // If this is a standard-sized chunk, return it to its pool unless that is full; otherwise free it.
   ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
-  if (pool != nullptr) {
-    pool->return_to_pool(c);
-  } else {
+  if (pool == nullptr || !pool->return_to_pool(c)) {
     ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
     os::free(c);
   }
@@ -170,6 +206,16 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
 
 ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
 
+ChunkPool ChunkPool::_large_pools[] = {
+  { 64*K - Chunk::slack, _max_large_pool_chunks },
+  { 128*K - Chunk::slack, _max_large_pool_chunks },
+  { 256*K - Chunk::slack, _max_large_pool_chunks },
+  { 512*K - Chunk::slack, _max_large_pool_chunks },
+  { 1*M - Chunk::slack, _max_large_pool_chunks },
+  { 2*M - Chunk::slack, _max_large_pool_chunks },
+  { 4*M - Chunk::slack, _max_large_pool_chunks }
+};
+
 class ChunkPoolCleaner : public PeriodicTask {
   static const int cleaning_interval = 5000; // cleaning interval in ms
 
@@ -277,6 +323,10 @@ void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   // Get minimal required size.  Either real big, or even bigger for giant objs
   // (Note: all chunk sizes have to be 64-bit aligned)
   size_t len = MAX2(ARENA_ALIGN(x), (size_t) Chunk::size);
+  if (PoolLargeArenaChunks && len > Chunk::size) {
+    // Use a size class, so the chunk can be reused by later large requests
+    len = ChunkPool::large_size_class(len);
+  }
 
   if (MemTracker::check_exceeds_limit(x, _flags)) {
     return nullptr;
@@ -56,6 +56,7 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
 }
 
 SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
+ReservedMemoryRegion* VirtualMemoryTracker::_last_reserved_region = nullptr;
 
 int compare_committed_region(const CommittedMemoryRegion& r1, const CommittedMemoryRegion& r2) {
   return r1.compare(r2);
@@ -335,6 +336,17 @@ bool VirtualMemoryTracker::initialize(NMT_TrackingLevel level) {
   return true;
 }
 
+ReservedMemoryRegion* VirtualMemoryTracker::find_reserved_region(address addr, size_t size) {
+  if (_last_reserved_region != nullptr && _last_reserved_region->contain_region(addr, size)) {
+    return _last_reserved_region;
+  }
+  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(ReservedMemoryRegion(addr, size));
+  if (reserved_rgn != nullptr) {
+    _last_reserved_region = reserved_rgn;
+  }
+  return reserved_rgn;
+}
+
 bool VirtualMemoryTracker::add_reserved_region(address base_addr, size_t size,
     const NativeCallStack& stack, MEMFLAGS flag) {
   assert(base_addr != nullptr, "Invalid address");
@@ -438,7 +450,7 @@ bool VirtualMemoryTracker::add_committed_region(address addr, size_t size,
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(addr, size);
 
   if (reserved_rgn == nullptr) {
     log_debug(nmt)("Add committed region \'%s\', No reserved region found for  (" INTPTR_FORMAT ", " SIZE_FORMAT ")",
@@ -457,8 +469,7 @@ bool VirtualMemoryTracker::remove_uncommitted_region(address addr, size_t size)
   assert(size > 0, "Invalid size");
   assert(_reserved_regions != nullptr, "Sanity check");
 
-  ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(addr, size);
   assert(reserved_rgn != nullptr, "No reserved region (" INTPTR_FORMAT ", " SIZE_FORMAT ")", p2i(addr), size);
   assert(reserved_rgn->contain_region(addr, size), "Not completely contained");
   const char* flag_name = reserved_rgn->flag_name();  // after remove, info is not complete
@@ -482,6 +493,8 @@ bool VirtualMemoryTracker::remove_released_region(ReservedMemoryRegion* rgn) {
   }
 
   VirtualMemorySummary::record_released_memory(rgn->size(), rgn->flag());
+  // The cached region may be the one removed below
+  _last_reserved_region = nullptr;
   result =  _reserved_regions->remove(*rgn);
   log_debug(nmt)("Removed region \'%s\' (" INTPTR_FORMAT ", " SIZE_FORMAT ") from _reserved_regions %s" ,
                 backup.flag_name(), p2i(backup.base()), backup.size(), (result ? "Succeeded" : "Failed"));
@@ -403,7 +403,14 @@ class VirtualMemoryTracker : AllStatic {
   static void snapshot_thread_stacks();
 
  private:
+  // Returns the reserved region containing the given range, or null.
+  static ReservedMemoryRegion* find_reserved_region(address addr, size_t size);
+
   static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+  // The region last found by find_reserved_region(). Commits and uncommits
+  // tend to hit the same reservation repeatedly, so this saves walking
+  // the list for most of them.
+  static ReservedMemoryRegion* _last_reserved_region;
 };
 
 #endif // SHARE_NMT_VIRTUALMEMORYTRACKER_HPP
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "cds/archiveBuilder.hpp"
 #include "cds/cdsConfig.hpp"
+#include "cds/classPrelinker.hpp"
 #include "cds/heapShared.hpp"
 #include "classfile/resolutionErrors.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -397,9 +398,7 @@ void ConstantPoolCache::remove_unshareable_info() {
     }
   }
   if (_resolved_field_entries != nullptr) {
-    for (int i = 0; i < _resolved_field_entries->length(); i++) {
-      resolved_field_entry_at(i)->remove_unshareable_info();
-    }
+    remove_resolved_field_entries_if_non_deterministic();
   }
   if (_resolved_method_entries != nullptr) {
     for (int i = 0; i < _resolved_method_entries->length(); i++) {
@@ -407,6 +406,28 @@ void ConstantPoolCache::remove_unshareable_info() {
     }
   }
 }
+
+void ConstantPoolCache::remove_resolved_field_entries_if_non_deterministic() {
+  ConstantPool* src_cp = ArchiveBuilder::current()->get_source_addr(constant_pool());
+  for (int i = 0; i < _resolved_field_entries->length(); i++) {
+    ResolvedFieldEntry* rfe = resolved_field_entry_at(i);
+    int cp_index = rfe->constant_pool_index();
+    bool resolved = rfe->is_resolved(Bytecodes::_getfield) || rfe->is_resolved(Bytecodes::_putfield);
+    if (ArchiveFieldReferences && resolved &&
+        ClassPrelinker::can_archive_resolved_field(src_cp, cp_index, rfe->field_holder())) {
+      if (log_is_enabled(Debug, cds, resolve)) {
+        ResourceMark rm;
+        log_debug(cds, resolve)("Resolved field CP entry [%d]: %s => %s.%s", cp_index,
+                                src_cp->pool_holder()->external_name(),
+                                rfe->field_holder()->external_name(),
+                                src_cp->uncached_name_ref_at(cp_index)->as_C_string());
+      }
+      rfe->mark_and_relocate();
+    } else {
+      rfe->remove_unshareable_info();
+    }
+  }
+}
 #endif // INCLUDE_CDS
 
 void ConstantPoolCache::deallocate_contents(ClassLoaderData* data) {
@@ -193,6 +193,7 @@ class ConstantPoolCache: public MetaspaceObj {
 
 #if INCLUDE_CDS
   void remove_unshareable_info();
+  void remove_resolved_field_entries_if_non_deterministic();
   void save_for_archive(TRAPS);
 #endif
 
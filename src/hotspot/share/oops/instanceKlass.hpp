@@ -748,6 +748,9 @@ class InstanceKlass: public Klass {
   JvmtiCachedClassFieldMap* jvmti_cached_class_field_map() const {
     return _jvmti_cached_class_field_map;
   }
+  // for maps that are published while parallel heap walk workers read them
+  inline JvmtiCachedClassFieldMap* jvmti_cached_class_field_map_acquire() const;
+  inline void release_set_jvmti_cached_class_field_map(JvmtiCachedClassFieldMap* descriptor);
 #else // INCLUDE_JVMTI
 
   static void purge_previous_versions(InstanceKlass* ik) { return; };
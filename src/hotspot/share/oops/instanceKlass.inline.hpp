@@ -79,6 +79,16 @@ inline void InstanceKlass::release_set_methods_jmethod_ids(jmethodID* jmeths) {
   Atomic::release_store(&_methods_jmethod_ids, jmeths);
 }
 
+#if INCLUDE_JVMTI
+inline JvmtiCachedClassFieldMap* InstanceKlass::jvmti_cached_class_field_map_acquire() const {
+  return Atomic::load_acquire(&_jvmti_cached_class_field_map);
+}
+
+inline void InstanceKlass::release_set_jvmti_cached_class_field_map(JvmtiCachedClassFieldMap* descriptor) {
+  Atomic::release_store(&_jvmti_cached_class_field_map, descriptor);
+}
+#endif // INCLUDE_JVMTI
+
 // The iteration over the oops in objects is a hot path in the GC code.
 // By force inlining the following functions, we get similar GC performance
 // as the previous macro based implementation.
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/archiveBuilder.hpp"
 #include "resolvedFieldEntry.hpp"
 
 void ResolvedFieldEntry::print_on(outputStream* st) const {
@@ -48,3 +49,12 @@ void ResolvedFieldEntry::remove_unshareable_info() {
   memset(this, 0, sizeof(*this));
   _cpool_index = saved_cpool_index;
 }
+
+#if INCLUDE_CDS
+// Keep the resolved entry in the archive. The field holder is the only
+// pointer, and it has to point to the archived copy of the holder.
+void ResolvedFieldEntry::mark_and_relocate() {
+  assert(is_resolved(Bytecodes::_getfield) || is_resolved(Bytecodes::_putfield), "must be");
+  ArchiveBuilder::current()->write_pointer_in_buffer(&_field_holder, _field_holder);
+}
+#endif
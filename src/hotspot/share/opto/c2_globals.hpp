@@ -64,6 +64,10 @@
           "available.")                                                     \
           range(0, max_juint)                                               \
                                                                             \
+  product(uintx, C2PhaseTimeReportThreshold, 0, DIAGNOSTIC,                 \
+          "Log per-phase times of method compilations that take at least "  \
+          "this many milliseconds (0 means never)")                         \
+                                                                            \
   develop(bool, StressMethodHandleLinkerInlining, false,                    \
           "Stress inlining through method handle linkers")                  \
                                                                             \
@@ -335,6 +339,15 @@
   develop(bool, TraceLoopUnswitching, false,                                \
           "Trace loop unswitching")                                         \
                                                                             \
+  product(bool, LoopUnswitchingUseProfile, false, EXPERIMENTAL,             \
+          "Use profiled branch counts to select the invariant test to "     \
+          "unswitch on, and do not unswitch on tests never executed")       \
+                                                                            \
+  product(bool, UseUnorderedFPReductions, false, EXPERIMENTAL,              \
+          "Allow auto-vectorized float and double add and mul reductions "  \
+          "to be reassociated into per-lane partial sums. This does not "   \
+          "preserve the Java floating-point evaluation order")              \
+                                                                            \
   product(bool, AllowVectorizeOnDemand, true,                               \
           "Globally suppress vectorization set in VectorizeMethod")         \
                                                                             \
@@ -41,6 +41,8 @@
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm_io.h"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
@@ -78,6 +80,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -636,6 +639,9 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _has_method_handle_invokes(false),
                   _clinit_barrier_on_entry(false),
                   _stress_seed(0),
+                  _start_ticks(os::elapsed_counter()),
+                  _phase_ticks(),
+                  _phase_names(),
                   _comp_arena(mtCompiler),
                   _barrier_set_state(BarrierSet::barrier_set()->barrier_set_c2()->create_barrier_state(comp_arena())),
                   _env(ci_env),
@@ -884,6 +890,10 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
 
   // Now generate code
   Code_Gen();
+
+  if (C2PhaseTimeReportThreshold > 0 && !failing()) {
+    report_phase_times();
+  }
 }
 
 //------------------------------Compile----------------------------------------
@@ -917,6 +927,9 @@ Compile::Compile( ciEnv* ci_env,
     _has_method_handle_invokes(false),
     _clinit_barrier_on_entry(false),
     _stress_seed(0),
+    _start_ticks(os::elapsed_counter()),
+    _phase_ticks(),
+    _phase_names(),
     _comp_arena(mtCompiler),
     _barrier_set_state(BarrierSet::barrier_set()->barrier_set_c2()->create_barrier_state(comp_arena())),
     _env(ci_env),
@@ -4408,9 +4421,16 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
     _compile(Compile::current()),
     _log(nullptr),
     _phase_name(name),
-    _dolog(CITimeVerbose)
+    _dolog(CITimeVerbose),
+    _phase_id(-1),
+    _start_ticks(0)
 {
   assert(_compile != nullptr, "sanity check");
+  if (C2PhaseTimeReportThreshold > 0 &&
+      accumulator >= &Phase::timers[0] && accumulator < &Phase::timers[Phase::max_phase_timers]) {
+    _phase_id = checked_cast<int>(accumulator - &Phase::timers[0]);
+    _start_ticks = os::elapsed_counter();
+  }
   if (_dolog) {
     _log = _compile->log();
   }
@@ -4423,6 +4443,9 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
 
 Compile::TracePhase::~TracePhase() {
   if (_compile->failing()) return;
+  if (_phase_id >= 0) {
+    _compile->record_phase_time(_phase_id, _phase_name, os::elapsed_counter() - _start_ticks);
+  }
 #ifdef ASSERT
   if (PrintIdealNodeCount) {
     tty->print_cr("phase name='%s' nodes='%d' live='%d' live_graph_walk='%d'",
@@ -4439,6 +4462,44 @@ Compile::TracePhase::~TracePhase() {
   }
 }
 
+void Compile::record_phase_time(int phase_id, const char* name, jlong ticks) {
+  assert(0 <= phase_id && phase_id < Phase::max_phase_timers, "invalid phase id %d", phase_id);
+  _phase_ticks[phase_id] += ticks;
+  // Some phases are traced without a name; keep the first non-empty one.
+  if (_phase_names[phase_id] == nullptr || _phase_names[phase_id][0] == '\0') {
+    _phase_names[phase_id] = name;
+  }
+}
+
+// Log the time spent in each phase of this compilation, if it took at
+// least C2PhaseTimeReportThreshold milliseconds.  Phases nest, so an outer
+// phase's time includes the time of the phases within it.
+void Compile::report_phase_times() const {
+  jlong total = os::elapsed_counter() - _start_ticks;
+  double total_ms = TimeHelper::counter_to_millis(total);
+  if (total_ms < C2PhaseTimeReportThreshold) {
+    return;
+  }
+  LogTarget(Info, jit, compilation) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  LogStream ls(lt);
+  ls.print("C2 compile %d took %.1f ms, %u nodes:", _compile_id, total_ms, unique());
+  for (int i = 0; i < Phase::max_phase_timers; i++) {
+    double ms = TimeHelper::counter_to_millis(_phase_ticks[i]);
+    if (ms >= 0.1) {
+      const char* name = _phase_names[i];
+      if (name != nullptr && name[0] != '\0') {
+        ls.print(" %s=%.1f", name, ms);
+      } else {
+        ls.print(" phase%d=%.1f", i, ms);
+      }
+    }
+  }
+  ls.cr();
+}
+
 //----------------------------static_subtype_check-----------------------------
 // Shortcut important common cases when superklass is exact:
 // (0) superklass is java.lang.Object (can occur in reflective code)
@@ -241,11 +241,18 @@ class Compile : public Phase {
     CompileLog* _log;
     const char* _phase_name;
     bool _dolog;
+    // For the per-compilation phase times, see C2PhaseTimeReportThreshold.
+    int _phase_id;
+    jlong _start_ticks;
    public:
     TracePhase(const char* name, elapsedTimer* accumulator);
     ~TracePhase();
   };
 
+  // Per-compilation phase times, collected by TracePhase.
+  void record_phase_time(int phase_id, const char* name, jlong ticks);
+  void report_phase_times() const;
+
   // Information per category of alias (memory slice)
   class AliasType {
    private:
@@ -359,6 +366,11 @@ class Compile : public Phase {
   int                   _loop_opts_cnt;         // loop opts round
   uint                  _stress_seed;           // Seed for stress testing
 
+  // Per-compilation phase times, only collected with C2PhaseTimeReportThreshold.
+  jlong                 _start_ticks;           // Start of the compilation
+  jlong                 _phase_ticks[Phase::max_phase_timers];
+  const char*           _phase_names[Phase::max_phase_timers];
+
   // Compilation environment.
   Arena                 _comp_arena;            // Arena with lifetime equivalent to Compile
   void*                 _barrier_set_state;     // Potential GC barrier state for Compile
@@ -117,11 +117,25 @@ bool IdealLoopTree::policy_unswitching(PhaseIdealLoop* phase) const {
   return phase->may_require_nodes(est_loop_clone_sz(2));
 }
 
+// Profile weight of an unswitch candidate: the number of times the test was executed, scaled by how balanced its
+// branches are. A test that almost always goes the same way gains little from unswitching, since the other loop
+// version is dead weight. Returns a negative value if there is no profile information.
+static float unswitch_candidate_weight(const IfNode* iff) {
+  if (iff->_fcnt == COUNT_UNKNOWN || iff->_prob == PROB_UNKNOWN) {
+    return -1.0f;
+  }
+  float balance = MIN2(iff->_prob, 1.0f - iff->_prob);
+  // Keep some benefit for removing the test itself, however biased it is.
+  return iff->_fcnt * (PROB_MIN + balance);
+}
+
 // Find an invariant test in the loop body that does not exit the loop. If multiple tests are found, we pick the first
-// one in the loop body. Return the "unswitch candidate" If to apply Loop Unswitching on.
+// one in the loop body, or with LoopUnswitchingUseProfile the one with the highest profile weight. Return the
+// "unswitch candidate" If to apply Loop Unswitching on.
 IfNode* PhaseIdealLoop::find_unswitch_candidate(const IdealLoopTree* loop) const {
   LoopNode* head = loop->_head->as_Loop();
   IfNode* unswitch_candidate = nullptr;
+  float candidate_weight = -1.0f;
   Node* n = head->in(LoopNode::LoopBackControl);
   while (n != head) {
     Node* n_dom = idom(n);
@@ -135,7 +149,16 @@ IfNode* PhaseIdealLoop::find_unswitch_candidate(const IdealLoopTree* loop) const
             // then found reason to unswitch.
             if (loop->is_invariant(bol) && !loop->is_loop_exit(iff)) {
               assert(iff->Opcode() == Op_If || iff->is_RangeCheck() || iff->is_BaseCountedLoopEnd(), "valid ifs");
-              unswitch_candidate = iff;
+              if (!LoopUnswitchingUseProfile) {
+                unswitch_candidate = iff;
+              } else {
+                // Walking from the back edge towards the head, so prefer the later found on ties.
+                float weight = unswitch_candidate_weight(iff);
+                if (unswitch_candidate == nullptr || weight >= candidate_weight) {
+                  unswitch_candidate = iff;
+                  candidate_weight = weight;
+                }
+              }
             }
           }
         }
@@ -143,6 +166,12 @@ IfNode* PhaseIdealLoop::find_unswitch_candidate(const IdealLoopTree* loop) const
     }
     n = n_dom;
   }
+  if (LoopUnswitchingUseProfile && unswitch_candidate != nullptr &&
+      unswitch_candidate->_fcnt != COUNT_UNKNOWN && unswitch_candidate->_fcnt < 1.0f) {
+    // The profile says the best test was never executed; unswitching would only consume node budget that is
+    // better spent on hot loops.
+    return nullptr;
+  }
   return unswitch_candidate;
 }
 
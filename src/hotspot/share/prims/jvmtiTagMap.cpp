@@ -29,6 +29,9 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/taskTerminator.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -37,6 +40,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/arrayOop.hpp"
 #include "oops/constantPool.inline.hpp"
+#include "oops/instanceKlass.inline.hpp"
 #include "oops/instanceMirrorKlass.hpp"
 #include "oops/klass.inline.hpp"
 #include "oops/objArrayKlass.hpp"
@@ -50,6 +54,7 @@
 #include "prims/jvmtiTagMap.hpp"
 #include "prims/jvmtiTagMapTable.hpp"
 #include "prims/jvmtiThreadState.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/continuationWrapper.inline.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
@@ -67,11 +72,17 @@
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/objectBitSet.inline.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/ticks.hpp"
 
 typedef ObjectBitSet<mtServiceability> JVMTIBitSet;
 
+typedef OverflowTaskQueue<oop, mtServiceability> JvmtiHeapWalkQueue;
+typedef GenericTaskQueueSet<JvmtiHeapWalkQueue, mtServiceability> JvmtiHeapWalkQueueSet;
+
 bool JvmtiTagMap::_has_object_free_events = false;
 
 // create a JvmtiTagMap
@@ -168,8 +179,174 @@ void JvmtiTagMap::check_hashmaps_for_heapwalk(GrowableArray<jlong>* objects) {
   }
 }
 
+// The visited set of a parallel heap walk. Like JVMTIBitSet it is a sparse
+// bitmap with one bit per ObjAlignmentInBytes-aligned address, allocated in
+// fragments covering 64M heap ranges. The fragments are found through a
+// two-level directory indexed by the address and are installed with a CAS,
+// so the workers can mark objects without taking a lock.
+class ParallelHeapWalkBitSet : public CHeapObj<mtServiceability> {
+ private:
+  static const size_t fragment_shift = 26; // 64M
+  static const size_t fragment_mask = ((size_t)1 << fragment_shift) - 1;
+  static const size_t directory_shift = 11;
+  static const size_t directory_size = (size_t)1 << directory_shift;
+
+  typedef CHeapBitMap* volatile FragmentSlot;
+
+  FragmentSlot* volatile _directory[directory_size];
+
+  static size_t fragment_index(uintptr_t addr) { return addr >> fragment_shift; }
+
+  CHeapBitMap* fragment(size_t index) {
+    const size_t hi = index >> directory_shift;
+    const size_t lo = index & (directory_size - 1);
+
+    FragmentSlot* slots = Atomic::load_acquire(&_directory[hi]);
+    if (slots == nullptr) {
+      FragmentSlot* const new_slots = NEW_C_HEAP_ARRAY(FragmentSlot, directory_size, mtServiceability);
+      for (size_t i = 0; i < directory_size; i++) {
+        new_slots[i] = nullptr;
+      }
+      slots = Atomic::cmpxchg(&_directory[hi], (FragmentSlot*)nullptr, new_slots);
+      if (slots == nullptr) {
+        slots = new_slots;
+      } else {
+        FREE_C_HEAP_ARRAY(FragmentSlot, new_slots);
+      }
+    }
+
+    CHeapBitMap* bits = Atomic::load_acquire(&slots[lo]);
+    if (bits == nullptr) {
+      CHeapBitMap* const new_bits =
+        new CHeapBitMap((BitMap::idx_t)((fragment_mask + 1) >> LogMinObjAlignmentInBytes), mtServiceability);
+      bits = Atomic::cmpxchg(&slots[lo], (CHeapBitMap*)nullptr, new_bits);
+      if (bits == nullptr) {
+        bits = new_bits;
+      } else {
+        delete new_bits;
+      }
+    }
+    return bits;
+  }
+
+ public:
+  ParallelHeapWalkBitSet() {
+    for (size_t i = 0; i < directory_size; i++) {
+      _directory[i] = nullptr;
+    }
+  }
+
+  ~ParallelHeapWalkBitSet() {
+    for (size_t i = 0; i < directory_size; i++) {
+      FragmentSlot* const slots = _directory[i];
+      if (slots != nullptr) {
+        for (size_t j = 0; j < directory_size; j++) {
+          delete slots[j];
+        }
+        FREE_C_HEAP_ARRAY(FragmentSlot, slots);
+      }
+    }
+  }
+
+  // returns true if the address of the object can be marked in this bitset
+  static bool covers(oop obj) {
+    return fragment_index(cast_from_oop<uintptr_t>(obj)) < directory_size * directory_size;
+  }
+
+  // mark an object, returns false if it was already marked
+  bool par_mark(oop obj) {
+    assert(covers(obj), "object outside of the bitset");
+    const uintptr_t addr = cast_from_oop<uintptr_t>(obj);
+    const BitMap::idx_t bit = (BitMap::idx_t)((addr & fragment_mask) >> LogMinObjAlignmentInBytes);
+    return fragment(fragment_index(addr))->par_set_bit(bit);
+  }
+};
+
+// State of a parallel heap walk (FollowReferences with -XX:+JvmtiParallelHeapWalk).
+// While a parallel heap walk is active the callbacks are invoked concurrently
+// from the safepoint worker threads. The workers never lock per object:
+// - the tag map is read-only while the workers run. The tag changes made by
+//   the callbacks are buffered per worker and applied by the VM thread when
+//   the walk completes, so they are not visible to the other callbacks of
+//   the same walk.
+// - objects are marked as visited in a ParallelHeapWalkBitSet.
+// - the class field map cache is only locked when a map is added to it.
+class ParallelHeapWalk : AllStatic {
+ public:
+  // a tag change made by a callback
+  class TagUpdate {
+   private:
+    oop _obj;
+    jlong _tag;
+
+   public:
+    TagUpdate() : _obj(nullptr), _tag(0) {}
+    TagUpdate(oop obj, jlong tag) : _obj(obj), _tag(tag) {}
+
+    oop obj() const                           { return _obj; }
+    jlong tag() const                         { return _tag; }
+  };
+
+  typedef GrowableArrayCHeap<TagUpdate, mtServiceability> TagUpdates;
+
+ private:
+  static JvmtiHeapWalkQueueSet* _queues;
+  static ParallelHeapWalkBitSet* _visited;
+  static TagUpdates** _tag_updates;
+  static Monitor* _lock;
+  static volatile bool _aborted;
+
+ public:
+  static bool is_active()                     { return _queues != nullptr; }
+  static Monitor* lock()                      { return _lock; }
+  static ParallelHeapWalkBitSet* visited()    { return _visited; }
+
+  static void activate(JvmtiHeapWalkQueueSet* queues,
+                       ParallelHeapWalkBitSet* visited,
+                       TagUpdates** tag_updates,
+                       Monitor* lock) {
+    assert(Thread::current()->is_VM_thread(), "must be VMThread");
+    _queues = queues;
+    _visited = visited;
+    _tag_updates = tag_updates;
+    _lock = lock;
+    _aborted = false;
+  }
+
+  static void deactivate() {
+    assert(Thread::current()->is_VM_thread(), "must be VMThread");
+    _queues = nullptr;
+    _visited = nullptr;
+    _tag_updates = nullptr;
+    _lock = nullptr;
+  }
+
+  // push an object onto the queue of the current worker thread
+  static void push(oop obj) {
+    assert(is_active(), "not a parallel heap walk");
+    _queues->queue(WorkerThread::worker_id())->push(obj);
+  }
+
+  // record a tag change in the buffer of the current worker thread
+  static void defer_tag_update(oop obj, jlong tag) {
+    assert(is_active(), "not a parallel heap walk");
+    _tag_updates[WorkerThread::worker_id()]->append(TagUpdate(obj, tag));
+  }
+
+  // a callback asked to terminate the iteration
+  static void abort()                         { Atomic::store(&_aborted, true); }
+  static bool is_aborted()                    { return Atomic::load(&_aborted); }
+};
+
+JvmtiHeapWalkQueueSet* ParallelHeapWalk::_queues;
+ParallelHeapWalkBitSet* ParallelHeapWalk::_visited;
+ParallelHeapWalk::TagUpdates** ParallelHeapWalk::_tag_updates;
+Monitor* ParallelHeapWalk::_lock;
+volatile bool ParallelHeapWalk::_aborted;
+
 // Return the tag value for an object, or 0 if the object is
-// not tagged
+// not tagged. The tag map is not modified during a parallel heap
+// walk so it can be read without the lock.
 //
 static inline jlong tag_for(JvmtiTagMap* tag_map, oop o) {
   return tag_map->hashmap()->find(o);
@@ -197,6 +374,7 @@ class CallbackWrapper : public StackObj {
   oop _o;
   jlong _obj_size;
   jlong _obj_tag;
+  jlong _obj_tag_before;
   jlong _klass_tag;
 
  protected:
@@ -204,10 +382,10 @@ class CallbackWrapper : public StackObj {
 
   // invoked post-callback to tag, untag, or update the tag of an object
   void inline post_callback_tag_update(oop o, JvmtiTagMapTable* hashmap,
-                                       jlong obj_tag);
+                                       jlong obj_tag, jlong obj_tag_before);
  public:
   CallbackWrapper(JvmtiTagMap* tag_map, oop o) {
-    assert(Thread::current()->is_VM_thread() || tag_map->is_locked(),
+    assert(Thread::current()->is_VM_thread() || tag_map->is_locked() || ParallelHeapWalk::is_active(),
            "MT unsafe or must be VM thread");
 
     // object to tag
@@ -221,7 +399,8 @@ class CallbackWrapper : public StackObj {
     _hashmap = tag_map->hashmap();
 
     // get object tag
-    _obj_tag = _hashmap->find(_o);
+    _obj_tag = tag_for(tag_map, _o);
+    _obj_tag_before = _obj_tag;
 
     // get the class and the class's tag value
     assert(vmClasses::Class_klass()->is_mirror_instance_klass(), "Is not?");
@@ -230,7 +409,7 @@ class CallbackWrapper : public StackObj {
   }
 
   ~CallbackWrapper() {
-    post_callback_tag_update(_o, _hashmap, _obj_tag);
+    post_callback_tag_update(_o, _hashmap, _obj_tag, _obj_tag_before);
   }
 
   inline jlong* obj_tag_p()                     { return &_obj_tag; }
@@ -242,7 +421,16 @@ class CallbackWrapper : public StackObj {
 // callback post-callback to tag, untag, or update the tag of an object
 void inline CallbackWrapper::post_callback_tag_update(oop o,
                                                       JvmtiTagMapTable* hashmap,
-                                                      jlong obj_tag) {
+                                                      jlong obj_tag,
+                                                      jlong obj_tag_before) {
+  if (ParallelHeapWalk::is_active()) {
+    // the tag map is updated when the parallel heap walk completes
+    if (obj_tag != obj_tag_before) {
+      ParallelHeapWalk::defer_tag_update(o, obj_tag);
+    }
+    return;
+  }
+
   if (obj_tag == 0) {
     // callback has untagged the object, remove the entry if present
     hashmap->remove(o);
@@ -276,6 +464,7 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
   JvmtiTagMapTable* _referrer_hashmap;
   oop _referrer;
   jlong _referrer_obj_tag;
+  jlong _referrer_obj_tag_before;
   jlong _referrer_klass_tag;
   jlong* _referrer_tag_p;
 
@@ -297,7 +486,8 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
       _referrer_hashmap = tag_map->hashmap();
 
       // get object tag
-      _referrer_obj_tag = _referrer_hashmap->find(_referrer);
+      _referrer_obj_tag = tag_for(tag_map, _referrer);
+      _referrer_obj_tag_before = _referrer_obj_tag;
 
       _referrer_tag_p = &_referrer_obj_tag;
 
@@ -310,7 +500,8 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
     if (!is_reference_to_self()) {
       post_callback_tag_update(_referrer,
                                _referrer_hashmap,
-                               _referrer_obj_tag);
+                               _referrer_obj_tag,
+                               _referrer_obj_tag_before);
     }
   }
 
@@ -580,24 +771,33 @@ void JvmtiCachedClassFieldMap::add_to_class_list(InstanceKlass* ik) {
 // returns the instance field map for the given object
 // (returns field map cached by the InstanceKlass if possible)
 ClassFieldMap* JvmtiCachedClassFieldMap::get_map_of_instance_fields(oop obj) {
-  assert(Thread::current()->is_VM_thread(), "must be VMThread");
+  assert(Thread::current()->is_VM_thread() || ParallelHeapWalk::is_active(), "must be VMThread");
   assert(ClassFieldMapCacheMark::is_active(), "ClassFieldMapCacheMark not active");
 
   Klass* k = obj->klass();
   InstanceKlass* ik = InstanceKlass::cast(k);
 
   // return cached map if possible
-  JvmtiCachedClassFieldMap* cached_map = ik->jvmti_cached_class_field_map();
+  // pairs with the release when the map is published below
+  JvmtiCachedClassFieldMap* cached_map = ik->jvmti_cached_class_field_map_acquire();
   if (cached_map != nullptr) {
     assert(cached_map->field_map() != nullptr, "missing field list");
     return cached_map->field_map();
-  } else {
-    ClassFieldMap* field_map = ClassFieldMap::create_map_of_instance_fields(obj);
-    cached_map = new JvmtiCachedClassFieldMap(field_map);
-    ik->set_jvmti_cached_class_field_map(cached_map);
-    add_to_class_list(ik);
-    return field_map;
   }
+
+  // in a parallel heap walk another worker may have added the map
+  // before we got the lock
+  ConditionalMutexLocker ml(ParallelHeapWalk::lock(), ParallelHeapWalk::is_active(), Mutex::_no_safepoint_check_flag);
+  cached_map = ik->jvmti_cached_class_field_map();
+  if (cached_map != nullptr) {
+    return cached_map->field_map();
+  }
+
+  ClassFieldMap* field_map = ClassFieldMap::create_map_of_instance_fields(obj);
+  cached_map = new JvmtiCachedClassFieldMap(field_map);
+  ik->release_set_jvmti_cached_class_field_map(cached_map);
+  add_to_class_list(ik);
+  return field_map;
 }
 
 // remove the fields maps cached from all instanceKlasses
@@ -1482,9 +1682,15 @@ class CallbackInvoker : AllStatic {
   static GrowableArray<oop>* visit_stack()             { return _visit_stack; }
 
   // if the object hasn't been visited then push it onto the visit stack
-  // so that it will be visited later
+  // so that it will be visited later. In a parallel heap walk the object
+  // is pushed onto the queue of the current worker and the visited check
+  // is deferred until it is popped.
   static inline bool check_for_visit(oop obj) {
-    if (!_bitset->is_marked(obj)) visit_stack()->push(obj);
+    if (ParallelHeapWalk::is_active()) {
+      ParallelHeapWalk::push(obj);
+    } else if (!_bitset->is_marked(obj)) {
+      visit_stack()->push(obj);
+    }
     return true;
   }
 
@@ -2401,6 +2607,7 @@ bool StackRefCollector::process_frames(vframe* vf) {
 // - All visible/explainable objects from Universes::oops_do
 //
 class VM_HeapWalkOperation: public VM_Operation {
+  friend class ParallelHeapWalkTask;
  private:
   enum {
     initial_visit_stack_size = 4000
@@ -2454,6 +2661,13 @@ class VM_HeapWalkOperation: public VM_Operation {
   // visit an object
   inline bool visit(oop o);
 
+  // mark an object as visited, returns false if it was already visited
+  inline bool par_mark(oop o);
+
+  // visit all objects reachable from the visit stack using the
+  // safepoint workers, returns false if parallel visiting isn't possible
+  bool par_visit_all();
+
  public:
   VM_HeapWalkOperation(JvmtiTagMap* tag_map,
                        Handle initial_object,
@@ -2920,8 +3134,15 @@ inline bool VM_HeapWalkOperation::collect_vthread_stack_refs(oop vt) {
 //
 bool VM_HeapWalkOperation::visit(oop o) {
   // mark object as visited
-  assert(!_bitset.is_marked(o), "can't visit same object more than once");
-  _bitset.mark_obj(o);
+  if (ParallelHeapWalk::is_active()) {
+    if (!par_mark(o)) {
+      // already visited by another worker
+      return true;
+    }
+  } else {
+    assert(!_bitset.is_marked(o), "can't visit same object more than once");
+    _bitset.mark_obj(o);
+  }
 
   // instance
   if (o->is_instance()) {
@@ -2955,6 +3176,131 @@ bool VM_HeapWalkOperation::visit(oop o) {
   return true;
 }
 
+inline bool VM_HeapWalkOperation::par_mark(oop o) {
+  if (ParallelHeapWalkBitSet::covers(o)) {
+    return ParallelHeapWalk::visited()->par_mark(o);
+  }
+
+  // the address is outside of the lock-free bitset
+  MutexLocker ml(ParallelHeapWalk::lock(), Mutex::_no_safepoint_check_flag);
+  if (_bitset.is_marked(o)) {
+    return false;
+  }
+  _bitset.mark_obj(o);
+  return true;
+}
+
+class ParallelHeapWalkTerminator : public TerminatorTerminator {
+ public:
+  virtual bool should_exit_termination() {
+    return ParallelHeapWalk::is_aborted();
+  }
+};
+
+// Work-stealing visiting of the objects reachable from the visit stack
+class ParallelHeapWalkTask : public WorkerTask {
+ private:
+  VM_HeapWalkOperation* const _op;
+  JvmtiHeapWalkQueueSet* const _queues;
+  TaskTerminator _terminator;
+
+  bool pop(JvmtiHeapWalkQueue* queue, uint worker_id, oop& obj) {
+    return queue->pop_overflow(obj) || queue->pop_local(obj) || _queues->steal(worker_id, obj);
+  }
+
+ public:
+  ParallelHeapWalkTask(VM_HeapWalkOperation* op, JvmtiHeapWalkQueueSet* queues, uint nworkers) :
+    WorkerTask("JVMTI Heap Walk"),
+    _op(op),
+    _queues(queues),
+    _terminator(nworkers, queues) {}
+
+  virtual void work(uint worker_id) {
+    Thread* current_thread = Thread::current();
+    ResourceMark rm(current_thread);
+    HandleMark hm(current_thread);
+
+    JvmtiHeapWalkQueue* const queue = _queues->queue(worker_id);
+    ParallelHeapWalkTerminator terminator;
+    oop o;
+
+    do {
+      while (!ParallelHeapWalk::is_aborted() && pop(queue, worker_id, o)) {
+        if (!_op->visit(o)) {
+          ParallelHeapWalk::abort();
+        }
+      }
+    } while (!ParallelHeapWalk::is_aborted() && !_terminator.offer_termination(&terminator));
+  }
+};
+
+bool VM_HeapWalkOperation::par_visit_all() {
+  // Only FollowReferences may invoke the callbacks concurrently, the
+  // agent has to opt in since this relaxes the order of the callbacks.
+  if (!JvmtiParallelHeapWalk || !is_advanced_heap_walk()) {
+    return false;
+  }
+
+  WorkerThreads* const workers = Universe::heap()->safepoint_workers();
+  if (workers == nullptr || workers->active_workers() <= 1) {
+    return false;
+  }
+
+  const uint nworkers = workers->active_workers();
+  JvmtiHeapWalkQueueSet queues(nworkers);
+  for (uint i = 0; i < nworkers; i++) {
+    JvmtiHeapWalkQueue* const queue = new JvmtiHeapWalkQueue();
+    queues.register_queue(i, queue);
+  }
+
+  // distribute the roots over the worker queues
+  for (int i = 0; i < visit_stack()->length(); i++) {
+    queues.queue(i % nworkers)->push(visit_stack()->at(i));
+  }
+  visit_stack()->clear();
+
+  ParallelHeapWalkBitSet* const visited = new ParallelHeapWalkBitSet();
+  ParallelHeapWalk::TagUpdates** const tag_updates =
+    NEW_C_HEAP_ARRAY(ParallelHeapWalk::TagUpdates*, nworkers, mtServiceability);
+  for (uint i = 0; i < nworkers; i++) {
+    tag_updates[i] = new ParallelHeapWalk::TagUpdates();
+  }
+
+  const Ticks start = Ticks::now();
+
+  ParallelHeapWalk::activate(&queues, visited, tag_updates, tag_map()->lock());
+  ParallelHeapWalkTask task(this, &queues, nworkers);
+  workers->run_task(&task, nworkers);
+  ParallelHeapWalk::deactivate();
+
+  const Tickspan walk_time = Ticks::now() - start;
+
+  // apply the tag changes made by the callbacks
+  JvmtiTagMapTable* const hashmap = tag_map()->hashmap();
+  int num_tag_updates = 0;
+  for (uint i = 0; i < nworkers; i++) {
+    ParallelHeapWalk::TagUpdates* const updates = tag_updates[i];
+    for (int j = 0; j < updates->length(); j++) {
+      const ParallelHeapWalk::TagUpdate& update = updates->at(j);
+      if (update.tag() == 0) {
+        hashmap->remove(update.obj());
+      } else {
+        hashmap->add(update.obj(), update.tag());
+      }
+    }
+    num_tag_updates += updates->length();
+    delete updates;
+    delete queues.queue(i);
+  }
+  FREE_C_HEAP_ARRAY(ParallelHeapWalk::TagUpdates*, tag_updates);
+  delete visited;
+
+  log_debug(jvmti)("Parallel heap walk using %u workers: %.3fms, %d tag updates",
+                   nworkers, walk_time.seconds() * MILLIUNITS, num_tag_updates);
+
+  return true;
+}
+
 void VM_HeapWalkOperation::doit() {
   ResourceMark rm;
   ClassFieldMapCacheMark cm;
@@ -2977,6 +3323,10 @@ void VM_HeapWalkOperation::doit() {
   // object references required
   if (is_following_references()) {
 
+    if (par_visit_all()) {
+      return;
+    }
+
     // visit each object until all reachable objects have been
     // visited or the callback asked to terminate the iteration.
     while (!visit_stack()->is_empty()) {
@@ -788,6 +788,10 @@ const int ObjectAlignmentInBytes = 8;
           "where <= 0 is unlimited, default: 65536")                        \
           range(min_intx, max_intx)                                         \
                                                                             \
+  product(bool, UseJNIHandleAllocationCache, false, EXPERIMENTAL,           \
+          "Allocate JNI global and weak global handles from per-thread "   \
+          "caches of entries bulk allocated from the handle storage")       \
+                                                                            \
   product(bool, EagerXrunInit, false,                                       \
           "Eagerly initialize -Xrun libraries; allows startup profiling, "  \
           "but not all -Xrun libraries may support the state of the VM "    \
@@ -907,6 +911,13 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, VerifyBeforeIteration, false, DIAGNOSTIC,                   \
           "Verify memory system before JVMTI iteration")                    \
                                                                             \
+  product(bool, JvmtiParallelHeapWalk, false, EXPERIMENTAL,                 \
+          "Use the GC safepoint worker threads to follow references in "    \
+          "JVMTI FollowReferences. The heap callbacks are then invoked "    \
+          "concurrently and in no particular order, so the agent must be "  \
+          "MT-safe. Tags set by the callbacks take effect when the walk "   \
+          "completes")                                                      \
+                                                                            \
   /* compiler */                                                            \
                                                                             \
   /* notice: the max range value here is max_jint, not max_intx  */         \
@@ -1124,6 +1135,11 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, RewriteFrequentPairs,                                    \
           "Rewrite frequently used bytecode pairs into a single bytecode")  \
                                                                             \
+  product(uint, OopMapCacheSize, 32, EXPERIMENTAL,                          \
+          "Number of entries in the per-class cache of interpreter oop "    \
+          "maps used by GC stack scanning")                                 \
+          range(32, 4096)                                                   \
+                                                                            \
   product(bool, PrintInterpreter, false, DIAGNOSTIC,                        \
           "Print the generated interpreter code")                           \
                                                                             \
@@ -1825,6 +1841,10 @@ const int ObjectAlignmentInBytes = 8;
           "(will be rounded to nearest higher power of 2)")                 \
           range(minimumStringTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(bool, UseStringInternCache, false, EXPERIMENTAL,                  \
+          "Look up interned strings in a small per-thread cache of "        \
+          "recently interned strings before using the String table")        \
+                                                                            \
   product(uintx, SymbolTableSize, defaultSymbolTableSize, EXPERIMENTAL,     \
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
@@ -1860,6 +1880,10 @@ const int ObjectAlignmentInBytes = 8;
           "Minimum percentage of dead table entries for cleaning the table") \
           range(1, 100)                                                     \
                                                                             \
+  product(uint, StringDeduplicationThreads, 1, EXPERIMENTAL,                \
+          "Number of threads processing string deduplication requests")     \
+          range(1, 256)                                                     \
+                                                                            \
   product(bool, StringDeduplicationResizeALot, false, DIAGNOSTIC,           \
           "Force more frequent table resizing")                             \
                                                                             \
@@ -1952,6 +1976,11 @@ const int ObjectAlignmentInBytes = 8;
           "(Deprecated) Allow allocating fields in empty slots of "         \
           "super-classes")                                                  \
                                                                             \
+  product(bool, ContiguousOopFields, false, EXPERIMENTAL,                   \
+          "Allocate the reference fields of a class contiguously, and "     \
+          "directly after the reference fields of its super class when "    \
+          "possible, to reduce the number of oop map blocks")               \
+                                                                            \
   product(bool, DeoptimizeNMethodBarriersALot, false, DIAGNOSTIC,           \
                 "Make nmethod barriers deoptimise a lot.")                  \
                                                                             \
@@ -1974,6 +2003,11 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(bool, PoolLargeArenaChunks, false, EXPERIMENTAL,                  \
+          "Round arena chunks larger than the default chunk size up to a "  \
+          "power-of-two size class and keep a few freed chunks of each "    \
+          "class for reuse")                                                \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
@@ -28,6 +28,7 @@
 #include "ci/ciEnv.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/javaThreadStatus.hpp"
+#include "classfile/stringTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -429,6 +430,9 @@ JavaThread::JavaThread() :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_global_handle_cache(nullptr),
+  _jni_weak_global_handle_cache(nullptr),
+  _string_intern_cache(nullptr),
 
   _suspend_flags(0),
 
@@ -949,6 +953,9 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_thread_caches(this);
+  StringTable::release_intern_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1023,6 +1030,9 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_thread_caches(this);
+  StringTable::release_intern_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
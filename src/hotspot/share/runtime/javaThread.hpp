@@ -63,6 +63,8 @@ class JvmtiThreadState;
 class Metadata;
 class OopHandleList;
 class OopStorage;
+class OopStorageAllocationCache;
+class StringTableInternCache;
 class OSThread;
 
 class ThreadsList;
@@ -158,6 +160,14 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Caches of pre-allocated global and weak global handle entries,
+  // used with UseJNIHandleAllocationCache.
+  OopStorageAllocationCache* _jni_global_handle_cache;
+  OopStorageAllocationCache* _jni_weak_global_handle_cache;
+
+  // Recently interned strings, used with UseStringInternCache.
+  StringTableInternCache* _string_intern_cache;
+
  public:
   // For tracking the heavyweight monitor the thread is pending on.
   ObjectMonitor* current_pending_monitor() {
@@ -188,6 +198,15 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  OopStorageAllocationCache* jni_handle_cache(bool weak) const {
+    return weak ? _jni_weak_global_handle_cache : _jni_global_handle_cache;
+  }
+  void set_jni_handle_cache(bool weak, OopStorageAllocationCache* cache) {
+    (weak ? _jni_weak_global_handle_cache : _jni_global_handle_cache) = cache;
+  }
+
+  StringTableInternCache* string_intern_cache() const { return _string_intern_cache; }
+  void set_string_intern_cache(StringTableInternCache* cache) { _string_intern_cache = cache; }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -82,6 +82,41 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// Allocate an entry from storage.  With UseJNIHandleAllocationCache, a
+// JavaThread allocates from a lazily created thread-local cache of entries,
+// which is refilled by bulk allocation from storage.  This avoids locking
+// the storage's allocation mutex for most allocations.
+static oop* allocate_entry(OopStorage* storage, bool weak) {
+  if (UseJNIHandleAllocationCache) {
+    Thread* thread = Thread::current_or_null();
+    if (thread != nullptr && thread->is_Java_thread()) {
+      JavaThread* jt = JavaThread::cast(thread);
+      OopStorageAllocationCache* cache = jt->jni_handle_cache(weak);
+      if (cache == nullptr) {
+        cache = new (std::nothrow) OopStorageAllocationCache(storage);
+        if (cache == nullptr) return storage->allocate();
+        jt->set_jni_handle_cache(weak, cache);
+      }
+      assert(cache->storage() == storage, "invariant");
+      return cache->allocate();
+    }
+  }
+  return storage->allocate();
+}
+
+static void release_thread_cache(JavaThread* thread, bool weak) {
+  OopStorageAllocationCache* cache = thread->jni_handle_cache(weak);
+  if (cache != nullptr) {
+    thread->set_jni_handle_cache(weak, nullptr);
+    delete cache;               // Releases any remaining entries.
+  }
+}
+
+void JNIHandles::release_thread_caches(JavaThread* thread) {
+  release_thread_cache(thread, false /* weak */);
+  release_thread_cache(thread, true /* weak */);
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_stw_gc_active(), "can't extend the root set during GC pause");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +124,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_entry(global_handles(), false /* weak */);
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -111,7 +146,7 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_entry(weak_global_handles(), true /* weak */);
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
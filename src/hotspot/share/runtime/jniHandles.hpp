@@ -106,6 +106,9 @@ class JNIHandles : AllStatic {
   static jweak make_weak_global(Handle obj,
                                 AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void destroy_weak_global(jweak handle);
+
+  // Release the thread's cached global and weak global handle entries.
+  static void release_thread_caches(JavaThread* thread);
   static bool is_weak_global_cleared(jweak handle); // Test jweak without resolution
 
   // Debugging
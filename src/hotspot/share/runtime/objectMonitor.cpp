@@ -432,6 +432,9 @@ bool ObjectMonitor::enter(JavaThread* current) {
     // time and with the same address are likely (but not guaranteed) to
     // belong to the same object.
     event.set_address((uintptr_t)this);
+    // A low value means that spinning on this monitor has recently failed,
+    // i.e. the monitor tends to be held for long.
+    event.set_spinDuration(_SpinDuration);
   }
 
   { // Change java thread status to indicate blocked on monitor enter.
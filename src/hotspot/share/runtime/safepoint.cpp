@@ -36,6 +36,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -63,10 +64,13 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.inline.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
+#include "utilities/latencyHistogram.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
+#include "utilities/ticks.hpp"
 
 static void post_safepoint_begin_event(EventSafepointBegin& event,
                                        uint64_t safepoint_id,
@@ -95,6 +99,51 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
   }
 }
 
+// The last thread seen to stop by synchronize_threads(), and when.
+static JavaThread* late_thread = nullptr;
+static Ticks late_thread_stopped;
+
+// Report the last thread to reach the safepoint together with the Java
+// method it stopped in. For compiled code that is typically the first poll
+// after a long stretch of code without one, e.g. a counted loop.
+static void report_late_thread(uint64_t safepoint_id, const Ticks& sync_start) {
+  // Don't walk the stack of the thread unless someone is listening
+  if (!log_is_enabled(Debug, safepoint) && !EventSafepointLateThread::is_enabled()) {
+    return;
+  }
+
+  JavaThread* thread = late_thread;
+  Method* method = nullptr;
+  int bci = -1;
+  if (thread->has_last_Java_frame()) {
+    // The thread is stopped and only the method and bci are read,
+    // so the frames don't need to be processed.
+    vframeStream vfst(thread, false, false);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+      bci = vfst.bci();
+    }
+  }
+
+  if (log_is_enabled(Debug, safepoint)) {
+    ResourceMark rm;
+    log_debug(safepoint)("Last thread to reach safepoint: '%s' after " UINT64_FORMAT " us in %s @ %d",
+                         thread->name(), (late_thread_stopped - sync_start).microseconds(),
+                         method != nullptr ? method->external_name() : "<no Java frame>", bci);
+  }
+
+  EventSafepointLateThread event(UNTIMED);
+  if (event.should_commit()) {
+    event.set_starttime(sync_start);
+    event.set_endtime(late_thread_stopped);
+    event.set_safepointId(safepoint_id);
+    event.set_lateThread(JFR_THREAD_ID(thread));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.commit();
+  }
+}
+
 static void post_safepoint_end_event(EventSafepointEnd& event, uint64_t safepoint_id) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
@@ -243,10 +292,12 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
+    JavaThread* stopped = nullptr;
     while (cur_tss != nullptr) {
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        stopped = cur_tss->thread();
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -260,6 +311,11 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
     DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
+    if (stopped != nullptr) {
+      late_thread = stopped;
+      late_thread_stopped = Ticks::now();
+    }
+
     if (still_running > 0) {
       back_off(start_time);
     }
@@ -365,6 +421,8 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  late_thread = nullptr;
+  Ticks sync_start = Ticks::now();
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
@@ -417,6 +475,10 @@ void SafepointSynchronize::begin() {
                                    initial_running,
                                    _waiting_to_block, iterations);
 
+  if (late_thread != nullptr) {
+    report_late_thread(_safepoint_id, sync_start);
+  }
+
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
   post_safepoint_begin_event(begin_event, _safepoint_id, nof_threads, _current_jni_active_count);
@@ -960,6 +1022,7 @@ void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps)
   _nof_running = nof_running;
   _page_trap   = traps;
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
+  LatencyHistograms::time_to_safepoint.record(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
 }
 
 void SafepointTracing::end() {
@@ -216,6 +216,26 @@ class VMDynamicLibrariesDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class LatencyHistogramsDCmd : public DCmd {
+public:
+  LatencyHistogramsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "VM.latency_histograms";
+  }
+  static const char* description() {
+    return "Print percentiles of internal VM latencies, such as time to safepoint.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMUptimeDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _date;
@@ -155,16 +155,20 @@ void ExceptionsEventLog::log(Thread* thread, Handle h_exception, const char* mes
   if (!should_log()) return;
 
   double timestamp = fetch_timestamp();
-  MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
-  int index = compute_log_index();
-  _records[index].thread = thread;
-  _records[index].timestamp = timestamp;
-  stringStream st(_records[index].data.buffer(),
-                  _records[index].data.size());
+  // Printing the exception walks its class and message, so do it before
+  // taking the lock and only copy the result into the ring buffer.
+  ExtendedStringLogMessage msg;
+  stringStream st(msg.buffer(), msg.size());
   st.print("Exception <");
   h_exception->print_value_on(&st);
   st.print("%s%s> (" PTR_FORMAT ") \n"
            "thrown [%s, line %d]",
            message ? ": " : "", message ? message : "",
            p2i(h_exception()), file, line);
+
+  MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
+  int index = compute_log_index();
+  _records[index].thread = thread;
+  _records[index].timestamp = timestamp;
+  memcpy(_records[index].data.buffer(), msg.buffer(), st.size() + 1);
 }
@@ -173,11 +173,15 @@ class FormatStringEventLog : public EventLogBase< FormatStringLogMessage<bufsz>
     if (!this->should_log()) return;
 
     double timestamp = this->fetch_timestamp();
+    // Format outside the lock so that only the copy into the ring
+    // buffer is serialized between logging threads.
+    FormatStringLogMessage<bufsz> msg;
+    msg.printv(format, ap);
     MutexLocker ml(&this->_mutex, Mutex::_no_safepoint_check_flag);
     int index = this->compute_log_index();
     this->_records[index].thread = thread;
     this->_records[index].timestamp = timestamp;
-    this->_records[index].data.printv(format, ap);
+    memcpy(this->_records[index].data.buffer(), msg.buffer(), strlen(msg) + 1);
   }
 
   void log(Thread* thread, const char* format, ...) ATTRIBUTE_PRINTF(3, 4) {
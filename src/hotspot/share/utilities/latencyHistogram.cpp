@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/latencyHistogram.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+LatencyHistogram::LatencyHistogram(const char* name) : _name(name), _counts(), _max(0) {}
+
+// Values below sub_bucket_count have a bucket each. Larger values go to
+// one of the sub_bucket_count buckets of their power of two, selected by
+// the bits following the most significant one.
+int LatencyHistogram::bucket_index(uint64_t value) {
+  if (value < (uint64_t)sub_bucket_count) {
+    return (int)value;
+  }
+  const int msb = log2i(value);
+  const int sub_bucket = (int)(value >> (msb - sub_bucket_bits)) & (sub_bucket_count - 1);
+  return (msb - sub_bucket_bits + 1) * sub_bucket_count + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(int index) {
+  if (index < sub_bucket_count) {
+    return (uint64_t)index;
+  }
+  const int shift = index / sub_bucket_count - 1;
+  const uint64_t lower = (uint64_t)(sub_bucket_count + index % sub_bucket_count) << shift;
+  return lower + ((uint64_t)1 << shift) - 1;
+}
+
+void LatencyHistogram::record(jlong nanos) {
+  const uint64_t value = nanos < 0 ? 0 : (uint64_t)nanos;
+  Atomic::inc(&_counts[bucket_index(value)], memory_order_relaxed);
+  uint64_t cur = Atomic::load(&_max);
+  while (cur < value) {
+    const uint64_t old = Atomic::cmpxchg(&_max, cur, value, memory_order_relaxed);
+    if (old == cur) {
+      break;
+    }
+    cur = old;
+  }
+}
+
+uint64_t LatencyHistogram::count() const {
+  uint64_t total = 0;
+  for (int i = 0; i < bucket_count; i++) {
+    total += Atomic::load(&_counts[i]);
+  }
+  return total;
+}
+
+uint64_t LatencyHistogram::max() const {
+  return Atomic::load(&_max);
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const {
+  const uint64_t total = count();
+  if (total == 0) {
+    return 0;
+  }
+  const uint64_t target = MAX2((uint64_t)1, (uint64_t)(total * percent / 100.0 + 0.5));
+  uint64_t seen = 0;
+  for (int i = 0; i < bucket_count; i++) {
+    seen += Atomic::load(&_counts[i]);
+    if (seen >= target) {
+      return MIN2(bucket_upper_bound(i), max());
+    }
+  }
+  return max();
+}
+
+void LatencyHistogram::print_on(outputStream* st) const {
+  st->print_cr("%s (ns): count=" UINT64_FORMAT " p50=" UINT64_FORMAT " p90=" UINT64_FORMAT
+               " p99=" UINT64_FORMAT " p99.9=" UINT64_FORMAT " max=" UINT64_FORMAT,
+               _name, count(), percentile(50), percentile(90), percentile(99), percentile(99.9), max());
+}
+
+LatencyHistogram LatencyHistograms::time_to_safepoint("Time to safepoint");
+LatencyHistogram LatencyHistograms::compile_queue_wait("Compile queue wait");
+
+void LatencyHistograms::print_on(outputStream* st) {
+  time_to_safepoint.print_on(st);
+  compile_queue_wait.print_on(st);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_UTILITIES_LATENCYHISTOGRAM_HPP
+#define SHARE_UTILITIES_LATENCYHISTOGRAM_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// A fixed-size histogram of latencies in nanoseconds. The buckets are
+// log-linear, like those of an HdrHistogram: every power of two is split
+// into eight equally sized buckets, so each value is known to within 12.5%.
+// Recording a value is one atomic increment and never allocates, which
+// makes the histograms cheap enough to be always on.
+class LatencyHistogram {
+  static const int sub_bucket_bits = 3;
+  static const int sub_bucket_count = 1 << sub_bucket_bits;
+  static const int bucket_count = (BitsPerJavaLong - sub_bucket_bits + 1) * sub_bucket_count;
+
+  const char* const _name;
+  volatile uint64_t _counts[bucket_count];
+  volatile uint64_t _max;
+
+  static int bucket_index(uint64_t value);
+  static uint64_t bucket_upper_bound(int index);
+
+public:
+  LatencyHistogram(const char* name);
+
+  const char* name() const { return _name; }
+
+  void record(jlong nanos);
+
+  uint64_t count() const;
+  uint64_t max() const;
+  // Returns an upper bound of the given percentile of the recorded values.
+  uint64_t percentile(double percent) const;
+
+  void print_on(outputStream* st) const;
+};
+
+// The latency histograms maintained by the VM.
+class LatencyHistograms : AllStatic {
+public:
+  static LatencyHistogram time_to_safepoint;
+  static LatencyHistogram compile_queue_wait;
+
+  static void print_on(outputStream* st);
+};
+
+#endif // SHARE_UTILITIES_LATENCYHISTOGRAM_HPP
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_UTILITIES_OPENADDRESSINGHASHTABLE_HPP
+#define SHARE_UTILITIES_OPENADDRESSINGHASHTABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/count_trailing_zeros.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+#include <type_traits>
+
+// An insert-only hashtable with open addressing, for large maps of small keys
+// and values that are built once and then queried, such as the address maps
+// of the CDS ArchiveBuilder. Entries are stored inline in a single array, so
+// an insertion does not allocate a node and a lookup usually touches one
+// group of control bytes and one entry.
+//
+// The layout follows SwissTable. Every slot has a control byte that is either
+// Empty or the top 7 bits of the hash of the slot's key. A probe assembles
+// the 8 control bytes of a group into one word and compares them against the
+// hash all at once, then checks the keys of the matching slots only. Groups
+// are probed in triangular order, which visits every group of a power-of-two
+// sized table.
+//
+// The table is rehashed into twice the capacity when it becomes 7/8 full.
+// Hence a value pointer returned by put_if_absent() or get() is only valid
+// until the next insertion. Use ResourceHashtable when stable pointers are
+// needed, or when entries must be removed.
+template<
+    typename K, typename V,
+    MEMFLAGS MEM_TYPE,
+    unsigned (*HASH)  (K const&)           = primitive_hash<K>,
+    bool     (*EQUALS)(K const&, K const&) = primitive_equals<K>
+    >
+class OpenAddressingHashtable {
+  static_assert(std::is_trivially_copyable<K>::value, "K must be trivially copyable");
+  static_assert(std::is_trivially_copyable<V>::value, "V must be trivially copyable");
+
+  NONCOPYABLE(OpenAddressingHashtable);
+
+  static const unsigned GroupSize = 8;
+  static const uint8_t Empty = 0x80;
+
+  struct Entry {
+    K _key;
+    V _value;
+  };
+
+  unsigned _capacity;           // Number of slots; a power of two and at least GroupSize
+  unsigned _number_of_entries;
+  uint8_t* _ctrl;
+  Entry* _entries;
+
+  // Spreads the bits of the primitive hash, which is often just an address,
+  // over the group index (low bits) and the control byte tag (top bits).
+  static unsigned hash_of(const K& key) {
+    unsigned h = HASH(key);
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+  }
+
+  static uint8_t tag_of(unsigned hash) {
+    return (uint8_t)(hash >> 25);
+  }
+
+  unsigned group_mask() const {
+    return _capacity / GroupSize - 1;
+  }
+
+  unsigned max_entries() const {
+    return _capacity - _capacity / 8;
+  }
+
+  // Control bytes of group, with slot i in byte i counting from the least
+  // significant byte. Compiles to a single load on little-endian platforms.
+  uint64_t load_group(unsigned group) const {
+    const uint8_t* p = _ctrl + group * GroupSize;
+    uint64_t word = 0;
+    for (unsigned i = 0; i < GroupSize; i++) {
+      word |= (uint64_t)p[i] << (i * BitsPerByte);
+    }
+    return word;
+  }
+
+  // High bit set in every byte that may be equal to tag. A byte above a
+  // matching byte can be a false positive, which the key comparison filters.
+  static uint64_t match_tag(uint64_t group, uint8_t tag) {
+    const uint64_t lsbs = UCONST64(0x0101010101010101);
+    uint64_t x = group ^ (lsbs * tag);
+    return (x - lsbs) & ~x & (lsbs << 7);
+  }
+
+  // High bit set in every empty byte. Tags never have the high bit set.
+  static uint64_t match_empty(uint64_t group) {
+    return group & (UCONST64(0x0101010101010101) << 7);
+  }
+
+  static unsigned first_slot(uint64_t match) {
+    return (unsigned)count_trailing_zeros(match) / BitsPerByte;
+  }
+
+  void allocate(unsigned capacity) {
+    _capacity = capacity;
+    _ctrl = NEW_C_HEAP_ARRAY(uint8_t, capacity, MEM_TYPE);
+    _entries = NEW_C_HEAP_ARRAY(Entry, capacity, MEM_TYPE);
+    memset(_ctrl, Empty, capacity);
+  }
+
+  Entry* find(const K& key, unsigned hash) const {
+    const uint8_t tag = tag_of(hash);
+    unsigned group = hash & group_mask();
+    for (unsigned step = 1; ; step++) {
+      const uint64_t ctrl = load_group(group);
+      for (uint64_t match = match_tag(ctrl, tag); match != 0; match &= match - 1) {
+        Entry* entry = &_entries[group * GroupSize + first_slot(match)];
+        if (EQUALS(entry->_key, key)) {
+          return entry;
+        }
+      }
+      if (match_empty(ctrl) != 0) {
+        return nullptr;
+      }
+      // There is always an empty slot, so this terminates.
+      group = (group + step) & group_mask();
+    }
+  }
+
+  // Inserts a key that is known not to be in the table yet.
+  Entry* insert_new(const K& key, const V& value, unsigned hash) {
+    unsigned group = hash & group_mask();
+    for (unsigned step = 1; ; step++) {
+      const uint64_t empty = match_empty(load_group(group));
+      if (empty != 0) {
+        const unsigned slot = group * GroupSize + first_slot(empty);
+        _ctrl[slot] = tag_of(hash);
+        Entry* entry = &_entries[slot];
+        entry->_key = key;
+        entry->_value = value;
+        _number_of_entries++;
+        return entry;
+      }
+      group = (group + step) & group_mask();
+    }
+  }
+
+  void grow() {
+    const unsigned old_capacity = _capacity;
+    uint8_t* const old_ctrl = _ctrl;
+    Entry* const old_entries = _entries;
+    allocate(old_capacity * 2);
+    _number_of_entries = 0;
+    for (unsigned i = 0; i < old_capacity; i++) {
+      if (old_ctrl[i] != Empty) {
+        const Entry& e = old_entries[i];
+        insert_new(e._key, e._value, hash_of(e._key));
+      }
+    }
+    FREE_C_HEAP_ARRAY(uint8_t, old_ctrl);
+    FREE_C_HEAP_ARRAY(Entry, old_entries);
+  }
+
+public:
+  // Room for at least initial_size entries before the first rehash.
+  OpenAddressingHashtable(unsigned initial_size = 0) : _number_of_entries(0) {
+    allocate(MAX2(round_up_power_of_2(initial_size + initial_size / 7 + 1), GroupSize));
+  }
+
+  ~OpenAddressingHashtable() {
+    FREE_C_HEAP_ARRAY(uint8_t, _ctrl);
+    FREE_C_HEAP_ARRAY(Entry, _entries);
+  }
+
+  unsigned number_of_entries() const { return _number_of_entries; }
+  unsigned capacity() const          { return _capacity; }
+
+  V* get(const K& key) const {
+    Entry* entry = find(key, hash_of(key));
+    return entry != nullptr ? &entry->_value : nullptr;
+  }
+
+  bool contains(const K& key) const {
+    return get(key) != nullptr;
+  }
+
+  // Inserts (key, value) unless key is already present, and returns a pointer
+  // to the value in the table. *created tells whether the entry is new. If
+  // grown is not null, *grown tells whether the table was rehashed into a
+  // larger capacity to make room for the entry.
+  V* put_if_absent(const K& key, const V& value, bool* created, bool* grown = nullptr) {
+    const unsigned hash = hash_of(key);
+    Entry* entry = find(key, hash);
+    if (grown != nullptr) {
+      *grown = false;
+    }
+    if (entry != nullptr) {
+      *created = false;
+      return &entry->_value;
+    }
+    if (_number_of_entries >= max_entries()) {
+      grow();
+      if (grown != nullptr) {
+        *grown = true;
+      }
+    }
+    *created = true;
+    return &insert_new(key, value, hash)->_value;
+  }
+
+  // Calls function(K, V*) for every entry, in table order.
+  template<typename Function>
+  void iterate_all(Function function) const {
+    for (unsigned i = 0; i < _capacity; i++) {
+      if (_ctrl[i] != Empty) {
+        function(_entries[i]._key, &_entries[i]._value);
+      }
+    }
+  }
+};
+
+#endif // SHARE_UTILITIES_OPENADDRESSINGHASHTABLE_HPP
@@ -172,6 +172,9 @@ class StackIterator: public StackObj
 
   E  next() { return *next_addr(); }
   E* next_addr();
+  // Return the remaining items of the current segment, setting num_items
+  // to their number, and advance to the next segment.
+  E* next_segment(size_t* num_items);
 
   void sync(); // Sync the iterator's state to the stack's current state.
 
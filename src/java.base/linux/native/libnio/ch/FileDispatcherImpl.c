@@ -24,7 +24,9 @@
  */
 
 #include <sys/sendfile.h>
+#include <sys/stat.h>
 #include <dlfcn.h>
+#include <fcntl.h>
 
 #include "jni.h"
 #include "nio.h"
@@ -115,6 +117,19 @@ Java_sun_nio_ch_FileDispatcherImpl_transferTo0(JNIEnv *env, jobject this,
     }
 
     n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    if (n < 0 && errno == EINVAL) {
+        // sendfile does not support every target; if the target is a
+        // pipe the data can still be moved without a user-space copy
+        struct stat64 sb;
+        if (fstat64(dstFD, &sb) == 0 && S_ISFIFO(sb.st_mode)) {
+            n = splice(srcFD, &offset, dstFD, NULL, (size_t)count,
+                       SPLICE_F_MOVE);
+            if (n < 0 && errno != EINTR && errno != EAGAIN)
+                errno = EINVAL;
+        } else {
+            errno = EINVAL;
+        }
+    }
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
@@ -267,16 +267,13 @@ void SharedStringDecompressor::decompress_resource(u1* data,
                             // the case where we have a package.
                             // reconstruct the type full name
                             if (str_length > 0) {
-                                int len = str_length + 1;
-                                char* fullpkg = new char[len];
-                                char* pkg_base = fullpkg;
-                                memcpy(fullpkg, pkg, str_length);
-                                fullpkg += str_length;
-                                *fullpkg = '/';
-                                memcpy(uncompressed_resource, pkg_base, len);
-                                uncompressed_resource += len;
-                                delete[] pkg_base;
-                                desc_length += len;
+                                // copy the package and its separator directly
+                                // into the output, without a temporary buffer
+                                memcpy(uncompressed_resource, pkg, str_length);
+                                uncompressed_resource += str_length;
+                                *uncompressed_resource = '/';
+                                uncompressed_resource++;
+                                desc_length += str_length + 1;
                             } else { // Empty package
                                 // Nothing to do.
                             }
@@ -41,6 +41,7 @@ class G1CardSetContainersTest : public ::testing::Test {
 
   static void cardset_inlineptr_test(uint bits_per_card);
   static void cardset_array_test(uint cards_per_array);
+  static void cardset_array_runs_test(uint runs_per_array);
   static void cardset_bitmap_test(uint threshold, uint size_in_bits);
 };
 
@@ -188,6 +189,78 @@ void G1CardSetContainersTest::cardset_array_test(uint cards_per_array) {
   FREE_C_HEAP_ARRAY(mtGC, cardset_data);
 }
 
+void G1CardSetContainersTest::cardset_array_runs_test(uint runs_per_array) {
+  // Leave room for one more run to fill up the array at the end.
+  uint const entries_per_array = (runs_per_array + 1) * 2;
+  uint const run_length = 3;
+  uint const run_stride = run_length + 1;
+
+  uint8_t* cardset_data = NEW_C_HEAP_ARRAY(uint8_t, G1CardSetArray::size_in_bytes(entries_per_array), mtGC);
+  G1CardSetArray* cards = new (cardset_data) G1CardSetArray(1, entries_per_array, true /* run_encoded */);
+
+  ASSERT_TRUE(cards->is_run_encoded());
+  ASSERT_TRUE(cards->contains(1)); // Added during initialization
+  ASSERT_TRUE(cards->num_entries() == 2); // Check it's the only run.
+
+  G1AddCardResult res;
+
+  // Add runs of cards separated by one card, growing them in both directions.
+  for (uint i = 0; i < runs_per_array; i++) {
+    uint const start = 1 + i * run_stride;
+    if (i > 0) {
+      res = cards->add(start + 1);
+      ASSERT_TRUE(res == Added);
+      res = cards->add(start);
+      ASSERT_TRUE(res == Added);
+    } else {
+      res = cards->add(start + 1);
+      ASSERT_TRUE(res == Added);
+    }
+    res = cards->add(start + 2);
+    ASSERT_TRUE(res == Added);
+  }
+  ASSERT_TRUE(cards->num_entries() == entries_per_array - 2);
+
+  // Check they are in the container, and that the gaps are not.
+  for (uint i = 0; i < runs_per_array; i++) {
+    uint const start = 1 + i * run_stride;
+    for (uint j = 0; j < run_length; j++) {
+      ASSERT_TRUE(cards->contains(start + j));
+      res = cards->add(start + j);
+      ASSERT_TRUE(res == Found);
+    }
+    ASSERT_TRUE(!cards->contains(start + run_length));
+  }
+  ASSERT_TRUE(!cards->contains(0));
+
+  // Fill up the array with a single card run.
+  uint const last_card = 2 + runs_per_array * run_stride;
+  res = cards->add(last_card);
+  ASSERT_TRUE(res == Added);
+  ASSERT_TRUE(cards->num_entries() == entries_per_array);
+
+  // A full array must not take new cards, even if they extend an existing run.
+  {
+    res = cards->add(run_length + 1);
+    ASSERT_TRUE(res == Overflow);
+    ASSERT_TRUE(!cards->contains(run_length + 1));
+  }
+
+  // Verify iteration finds all cards too, and only those.
+  {
+    uint num_found = 0;
+    auto count_found = [&] (uint card) {
+      ASSERT_TRUE(card > 0);
+      ASSERT_TRUE((card - 1) % run_stride < run_length);
+      num_found++;
+    };
+    cards->iterate(count_found);
+    ASSERT_EQ(num_found, runs_per_array * run_length + 1);
+  }
+
+  FREE_C_HEAP_ARRAY(mtGC, cardset_data);
+}
+
 void G1CardSetContainersTest::cardset_bitmap_test(uint threshold, uint size_in_bits) {
   uint8_t* cardset_data = NEW_C_HEAP_ARRAY(uint8_t, G1CardSetBitMap::size_in_bytes(size_in_bits), mtGC);
   G1CardSetBitMap* cards = new (cardset_data) G1CardSetBitMap(1, size_in_bits);
@@ -253,6 +326,14 @@ TEST_VM_F(G1CardSetContainersTest, basic_cardset_array_test) {
   }
 }
 
+TEST_VM_F(G1CardSetContainersTest, basic_cardset_array_runs_test) {
+  uint runs_per_array[] = { 1, 4, 31, 63 };
+
+  for (uint i = 0; i < ARRAY_SIZE(runs_per_array); i++) {
+    G1CardSetContainersTest::cardset_array_runs_test(runs_per_array[i]);
+  }
+}
+
 TEST_VM_F(G1CardSetContainersTest, basic_cardset_bitmap_test) {
   uint bit_sizes[] = { 64, 2048 };
   uint threshold_sizes[] = { 17, 330 };
@@ -518,6 +518,38 @@ TEST_VM_F(OopStorageTest, bulk_allocation) {
   }
 }
 
+TEST_VM_F(OopStorageTest, allocation_cache) {
+  static const size_t max_entries = 100;
+  static const size_t zero = 0;
+  oop* entries[max_entries] = {};
+
+  OopStorageAllocationCache* cache = new OopStorageAllocationCache(&storage());
+  EXPECT_EQ(zero, cache->count());
+
+  for (size_t i = 0; i < max_entries; ++i) {
+    entries[i] = cache->allocate();
+    ASSERT_NE(nullptr, entries[i]);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, storage().allocation_status(entries[i]));
+  }
+  // The storage counts the entries held by the cache as allocated.
+  EXPECT_EQ(max_entries + cache->count(), storage().allocation_count());
+
+  cache->flush();
+  EXPECT_EQ(zero, cache->count());
+  EXPECT_EQ(max_entries, storage().allocation_count());
+
+  // Refill the cache, and verify the destructor releases cached entries.
+  oop* extra = cache->allocate();
+  ASSERT_NE(nullptr, extra);
+  EXPECT_NE(zero, cache->count());
+  delete cache;
+  EXPECT_EQ(max_entries + 1, storage().allocation_count());
+
+  storage().release(extra);
+  storage().release(entries, max_entries);
+  EXPECT_EQ(zero, storage().allocation_count());
+}
+
 #ifndef DISABLE_GARBAGE_ALLOCATION_STATUS_TESTS
 TEST_VM_F(OopStorageTest, invalid_pointer) {
   {
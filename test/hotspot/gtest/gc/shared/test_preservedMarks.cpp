@@ -86,3 +86,27 @@ TEST_VM(PreservedMarks, iterate_and_restore) {
   ASSERT_MARK_WORD_EQ(o3.mark(), FakeOop::changedMark());
   ASSERT_MARK_WORD_EQ(o4.mark(), FakeOop::changedMark());
 }
+
+TEST_VM(PreservedMarks, set_restore_multiple_segments) {
+  PreservedMarksSet pms(true /* in_c_heap */);
+  pms.init(2);
+
+  // Use more objects than fit into a single stack segment.
+  const size_t num_objs = pms.get(0)->segment_size() * 3 + 7;
+  FakeOop* objs = NEW_C_HEAP_ARRAY(FakeOop, num_objs, mtTest);
+  for (size_t i = 0; i < num_objs; i++) {
+    ::new (&objs[i]) FakeOop();
+    objs[i].set_mark(FakeOop::changedMark());
+    // Distribute the objects unevenly over the stacks.
+    pms.get(i % 4 == 0 ? 1 : 0)->push_if_necessary(objs[i].get_oop(), objs[i].mark());
+    objs[i].set_mark(FakeOop::originalMark());
+  }
+
+  pms.restore(nullptr);
+  for (size_t i = 0; i < num_objs; i++) {
+    ASSERT_MARK_WORD_EQ(objs[i].mark(), FakeOop::changedMark());
+  }
+
+  pms.reclaim();
+  FREE_C_HEAP_ARRAY(FakeOop, objs);
+}
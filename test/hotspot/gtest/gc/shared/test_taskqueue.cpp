@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+typedef GenericTaskQueue<uint, mtGC, 1024> TestTaskQueue;
+typedef GenericTaskQueueSet<TestTaskQueue, mtGC> TestTaskQueueSet;
+
+TEST_VM(TaskQueueTest, pop_global_batch) {
+  AutoSaveRestore<uint> FLAG_GUARD(TaskQueueStealBatchSize);
+  TaskQueueStealBatchSize = 8;
+
+  TestTaskQueue queue;
+  for (uint i = 0; i < 10; i++) {
+    ASSERT_TRUE(queue.push(i));
+  }
+
+  // Takes half of the elements, oldest first.
+  uint tasks[8];
+  uint num = 0;
+  ASSERT_EQ(TestTaskQueue::PopResult::Success, queue.pop_global_batch(tasks, 8, num));
+  ASSERT_EQ(5u, num);
+  for (uint i = 0; i < num; i++) {
+    ASSERT_EQ(i, tasks[i]);
+  }
+  ASSERT_EQ(5u, queue.size());
+
+  // Never more than max_num.
+  ASSERT_EQ(TestTaskQueue::PopResult::Success, queue.pop_global_batch(tasks, 1, num));
+  ASSERT_EQ(1u, num);
+  ASSERT_EQ(5u, tasks[0]);
+
+  // The remaining elements are popped locally, including the slow path
+  // taken when fewer than TaskQueueStealBatchSize elements remain.
+  uint t;
+  for (uint i = 10; i > 6; i--) {
+    ASSERT_TRUE(queue.pop_local(t));
+    ASSERT_EQ(i - 1, t);
+  }
+  ASSERT_FALSE(queue.pop_local(t));
+  ASSERT_EQ(TestTaskQueue::PopResult::Empty, queue.pop_global_batch(tasks, 8, num));
+  ASSERT_TRUE(queue.is_empty());
+}
+
+// Processes a binary tree of tasks: task i creates tasks 2i and 2i+1 below
+// the limit, so all work starts out in the queue of the first thread and is
+// distributed by stealing.
+class TaskQueueTestThread : public JavaTestThread {
+  uint _id;
+  TestTaskQueueSet* _queues;
+  volatile uint* _counts;
+  volatile uint* _processed;
+  uint _limit;
+  volatile bool _ready;
+
+  void push(uint task) {
+    if (task < _limit) {
+      bool pushed = _queues->queue(_id)->push(task);
+      guarantee(pushed, "queue overflow");
+    }
+  }
+
+  void process(uint task) {
+    Atomic::inc(&_counts[task]);
+    push(2 * task);
+    push(2 * task + 1);
+    Atomic::inc(_processed);
+  }
+
+public:
+  TaskQueueTestThread(Semaphore* post,
+                      uint id,
+                      TestTaskQueueSet* queues,
+                      volatile uint* counts,
+                      volatile uint* processed,
+                      uint limit) :
+    JavaTestThread(post),
+    _id(id),
+    _queues(queues),
+    _counts(counts),
+    _processed(processed),
+    _limit(limit),
+    _ready(false)
+  {}
+
+  virtual void main_run() {
+    Atomic::release_store_fence(&_ready, true);
+    uint task;
+    while (Atomic::load_acquire(_processed) < _limit - 1) {
+      if (_queues->queue(_id)->pop_local(task) || _queues->steal(_id, task)) {
+        process(task);
+      }
+    }
+  }
+
+  bool ready() const { return Atomic::load_acquire(&_ready); }
+};
+
+static void stress_steal(uint steal_batch_size) {
+  AutoSaveRestore<uint> FLAG_GUARD(TaskQueueStealBatchSize);
+  TaskQueueStealBatchSize = steal_batch_size;
+
+  const uint nthreads = 4;
+  const uint limit = 200000;
+  Semaphore post;
+  TestTaskQueueSet queues(nthreads);
+  TestTaskQueue* queue_array[nthreads];
+  for (uint i = 0; i < nthreads; i++) {
+    queue_array[i] = new TestTaskQueue();
+    queues.register_queue(i, queue_array[i]);
+  }
+
+  volatile uint* counts = NEW_C_HEAP_ARRAY(volatile uint, limit, mtGC);
+  for (uint i = 0; i < limit; i++) {
+    counts[i] = 0;
+  }
+  volatile uint processed = 0;
+
+  TaskQueueTestThread* threads[nthreads] = {};
+  for (uint i = 0; i < nthreads; i++) {
+    threads[i] = new TaskQueueTestThread(&post, i, &queues, counts, &processed, limit);
+    threads[i]->doit();
+    while (!threads[i]->ready()) {} // Wait until ready to start test.
+  }
+
+  // Push the root task to start the test.
+  ASSERT_TRUE(queue_array[0]->push(1u));
+
+  for (uint i = 0; i < nthreads; i++) {
+    post.wait();
+  }
+
+  // Every task has been processed exactly once.
+  ASSERT_EQ(limit - 1, processed);
+  for (uint i = 1; i < limit; i++) {
+    ASSERT_EQ(1u, counts[i]) << "task " << i;
+  }
+  for (uint i = 0; i < nthreads; i++) {
+    ASSERT_TRUE(queue_array[i]->is_empty());
+    delete queue_array[i];
+  }
+  FREE_C_HEAP_ARRAY(volatile uint, counts);
+}
+
+TEST_VM(TaskQueueTest, stress_steal) {
+  stress_steal(1);
+}
+
+TEST_VM(TaskQueueTest, stress_steal_batch) {
+  stress_steal(8);
+}
@@ -95,6 +95,28 @@ class ZBitMapTest : public ::testing::Test {
     test_set_pair_unset(128, finalizable);
   }
 
+  static void test_set_sorted_bits(size_t size, size_t stride) {
+    ZMovableBitMap bitmap;
+    bitmap.initialize(size, true /* clear */);
+
+    const size_t count = (size + stride - 1) / stride;
+    bitmap.par_set_sorted_bits(count, [&](size_t i) {
+      return i * stride;
+    });
+
+    for (BitMap::idx_t i = 0; i < size; i++) {
+      EXPECT_EQ(bitmap.at(i), i % stride == 0) << "Bit " << i;
+    }
+  }
+
+  static void test_set_sorted_bits() {
+    test_set_sorted_bits(1,   1);
+    test_set_sorted_bits(64,  1);
+    test_set_sorted_bits(64,  3);
+    test_set_sorted_bits(128, 7);
+    test_set_sorted_bits(256, 64);
+    test_set_sorted_bits(256, 65);
+  }
 };
 
 TEST_F(ZBitMapTest, test_set_pair_set) {
@@ -106,3 +128,7 @@ TEST_F(ZBitMapTest, test_set_pair_unset) {
   test_set_pair_unset(false);
   test_set_pair_unset(true);
 }
+
+TEST_F(ZBitMapTest, test_set_sorted_bits) {
+  test_set_sorted_bits();
+}
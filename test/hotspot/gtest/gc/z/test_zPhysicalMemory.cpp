@@ -217,3 +217,25 @@ TEST(ZPhysicalMemoryTest, limits) {
   EXPECT_EQ(pmem1.nsegments(), 1);
   EXPECT_EQ(pmem1.size(), HalfZAddressOffsetMax);
 }
+
+TEST(ZPhysicalMemoryTest, partial_extents) {
+  ZAddressOffsetMaxSetter setter;
+
+  // Whole extents
+  ZPhysicalMemory pmem0;
+  pmem0.add_segment(ZPhysicalMemorySegment(zoffset(0), 64, true));
+  pmem0.add_segment(ZPhysicalMemorySegment(zoffset(128), 32, true));
+  EXPECT_EQ(pmem0.npartial_extents(32), 0u);
+  EXPECT_EQ(pmem0.npartial_extents(64), 1u);
+
+  // Segment within a single extent
+  ZPhysicalMemory pmem1;
+  pmem1.add_segment(ZPhysicalMemorySegment(zoffset(8), 16, true));
+  EXPECT_EQ(pmem1.npartial_extents(32), 1u);
+
+  // Segment split at both ends
+  ZPhysicalMemory pmem2;
+  pmem2.add_segment(ZPhysicalMemorySegment(zoffset(16), 64, true));
+  EXPECT_EQ(pmem2.npartial_extents(32), 2u);
+  EXPECT_EQ(pmem2.npartial_extents(16), 0u);
+}
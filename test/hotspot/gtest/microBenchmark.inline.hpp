@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef GTEST_MICROBENCHMARK_INLINE_HPP
+#define GTEST_MICROBENCHMARK_INLINE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "threadHelper.inline.hpp"
+
+// Helper for running small throughput benchmarks of VM data structures from
+// gtests. A benchmark operation is a callable op(uint thread_id, size_t n)
+// that performs n operations. It is run for a number of warmup iterations,
+// then for a number of timed iterations, and the average time per operation
+// is printed. When run with several threads, all threads finish warming up
+// before any of them starts timing, and the reported time is the average of
+// the per-thread times, so ideal scaling shows as a constant ns/op.
+//
+// Like test_oopStorage_parperf.cpp, these report numbers rather than check
+// them, and only fail if the measured code does.
+class MicroBenchmark : public StackObj {
+  const char* const _name;
+  const size_t _ops;
+  const uint _warmup;
+  const uint _iterations;
+
+  template <typename F>
+  void warm_up(F& op, uint thread_id) const {
+    for (uint i = 0; i < _warmup; i++) {
+      op(thread_id, _ops);
+    }
+  }
+
+  template <typename F>
+  double time(F& op, uint thread_id) const {
+    jlong start = os::javaTimeNanos();
+    for (uint i = 0; i < _iterations; i++) {
+      op(thread_id, _ops);
+    }
+    jlong elapsed = os::javaTimeNanos() - start;
+    return (double)elapsed / ((double)_ops * _iterations);
+  }
+
+public:
+  // ops - operations per iteration and thread
+  MicroBenchmark(const char* name, size_t ops, uint warmup = 2, uint iterations = 5) :
+    _name(name), _ops(ops), _warmup(warmup), _iterations(iterations) {}
+
+  // Runs op in nthreads threads at once and returns the average ns/op.
+  template <typename F>
+  double run(F op, uint nthreads = 1) const {
+    double ns_per_op;
+    if (nthreads == 1) {
+      warm_up(op, 0);
+      ns_per_op = time(op, 0);
+    } else {
+      Semaphore ready(0);
+      Semaphore go(0);
+      double* results = NEW_C_HEAP_ARRAY(double, nthreads, mtTest);
+      auto body = [&](Thread* thread, int id) {
+        warm_up(op, (uint)id);
+        ready.signal();
+        go.wait();
+        results[id] = time(op, (uint)id);
+      };
+      TestThreadGroup<decltype(body)> group(body, (int)nthreads);
+      group.doit();
+      for (uint i = 0; i < nthreads; i++) {
+        ready.wait();
+      }
+      go.signal(nthreads);
+      group.join();
+      ns_per_op = 0.0;
+      for (uint i = 0; i < nthreads; i++) {
+        ns_per_op += results[i];
+      }
+      ns_per_op /= nthreads;
+      FREE_C_HEAP_ARRAY(double, results);
+    }
+    tty->print_cr("%s: %u thread%s: %.2f ns/op", _name, nthreads, nthreads == 1 ? "" : "s", ns_per_op);
+    return ns_per_op;
+  }
+
+  // Runs op with 1, 2, 4, ... threads, up to max_threads.
+  template <typename F>
+  void run_scaling(F op, uint max_threads) const {
+    for (uint n = 1; n <= max_threads; n *= 2) {
+      run(op, n);
+    }
+  }
+};
+
+#endif // GTEST_MICROBENCHMARK_INLINE_HPP
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "utilities/latencyHistogram.hpp"
+#include "unittest.hpp"
+
+TEST(LatencyHistogram, empty) {
+  LatencyHistogram h("test");
+  EXPECT_EQ(h.count(), (uint64_t)0);
+  EXPECT_EQ(h.max(), (uint64_t)0);
+  EXPECT_EQ(h.percentile(50), (uint64_t)0);
+}
+
+TEST(LatencyHistogram, small_values_are_exact) {
+  LatencyHistogram h("test");
+  for (jlong i = 0; i < 8; i++) {
+    h.record(i);
+  }
+  EXPECT_EQ(h.count(), (uint64_t)8);
+  EXPECT_EQ(h.max(), (uint64_t)7);
+  EXPECT_EQ(h.percentile(50), (uint64_t)3);
+  EXPECT_EQ(h.percentile(100), (uint64_t)7);
+}
+
+TEST(LatencyHistogram, percentiles_within_precision) {
+  LatencyHistogram h("test");
+  for (jlong i = 1; i <= 1000; i++) {
+    h.record(i * 1000);
+  }
+  EXPECT_EQ(h.count(), (uint64_t)1000);
+  EXPECT_EQ(h.max(), (uint64_t)1000000);
+  // Each bucket covers at most 1/8 of its power of two
+  uint64_t p50 = h.percentile(50);
+  EXPECT_GE(p50, (uint64_t)500000);
+  EXPECT_LE(p50, (uint64_t)500000 + 500000 / 8);
+  uint64_t p99 = h.percentile(99);
+  EXPECT_GE(p99, (uint64_t)990000);
+  EXPECT_LE(p99, (uint64_t)1000000);
+}
+
+TEST(LatencyHistogram, extreme_values) {
+  LatencyHistogram h("test");
+  h.record(-1);
+  h.record(max_jlong);
+  EXPECT_EQ(h.count(), (uint64_t)2);
+  EXPECT_EQ(h.max(), (uint64_t)max_jlong);
+  EXPECT_EQ(h.percentile(50), (uint64_t)0);
+  EXPECT_EQ(h.percentile(100), (uint64_t)max_jlong);
+}
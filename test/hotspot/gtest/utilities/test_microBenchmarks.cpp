@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
+#include "microBenchmark.inline.hpp"
+#include "unittest.hpp"
+
+// Throughput benchmarks for core VM data structures, see
+// microBenchmark.inline.hpp. The sizes are kept small so that these add
+// little to a normal gtest run; increase them when comparing changes.
+
+static uint max_benchmark_threads() {
+  return (uint)MIN2(os::active_processor_count(), 8);
+}
+
+TEST_VM(MicroBenchmark, growable_array_append) {
+  MicroBenchmark bench("GrowableArray::append", 100000);
+  bench.run([](uint id, size_t n) {
+    GrowableArrayCHeap<int, mtTest> array;
+    for (size_t i = 0; i < n; i++) {
+      array.append((int)i);
+    }
+  });
+}
+
+TEST_VM(MicroBenchmark, bitmap_set_and_find) {
+  const BitMap::idx_t size = 1 << 16;
+  CHeapBitMap map(size, mtTest);
+  MicroBenchmark set_bench("BitMap::set_bit", 100000);
+  set_bench.run([&](uint id, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+      map.set_bit((i * 7919) & (size - 1));
+    }
+  });
+  map.clear();
+  for (BitMap::idx_t i = 0; i < size; i += 61) {
+    map.set_bit(i);
+  }
+  MicroBenchmark find_bench("BitMap::find_first_set_bit", 100000);
+  find_bench.run([&](uint id, size_t n) {
+    BitMap::idx_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+      pos = map.find_first_set_bit(pos + 1);
+      if (pos >= size) {
+        pos = 0;
+      }
+    }
+  });
+}
+
+struct BenchmarkCHTConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)value * 0x9E3779B97F4A7C15ull;
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return os::malloc(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    os::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<BenchmarkCHTConfig, mtTest> BenchmarkCHT;
+
+struct BenchmarkCHTLookup {
+  uintptr_t _val;
+  BenchmarkCHTLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() { return BenchmarkCHTConfig::get_hash(_val, nullptr); }
+  bool equals(const uintptr_t* value) { return _val == *value; }
+  bool is_dead(const uintptr_t* value) { return false; }
+};
+
+TEST_VM(MicroBenchmark, concurrent_hash_table) {
+  const uintptr_t entries = 1 << 16;
+  BenchmarkCHT* table = new BenchmarkCHT(16);
+  Thread* thread = Thread::current();
+  for (uintptr_t i = 1; i <= entries; i++) {
+    BenchmarkCHTLookup lookup(i);
+    table->insert(thread, lookup, i);
+  }
+
+  MicroBenchmark get_bench("ConcurrentHashTable::get", 100000);
+  get_bench.run_scaling([&](uint id, size_t n) {
+    Thread* current = Thread::current();
+    uintptr_t found = 0;
+    auto sum = [&](uintptr_t* value) { found += *value; };
+    for (size_t i = 0; i < n; i++) {
+      BenchmarkCHTLookup lookup(1 + ((i * 7919 + id) & (entries - 1)));
+      table->get(current, lookup, sum);
+    }
+    EXPECT_NE(found, 0u);
+  }, max_benchmark_threads());
+
+  // Every thread inserts and removes its own keys, above the preloaded ones.
+  MicroBenchmark update_bench("ConcurrentHashTable::insert+remove", 20000);
+  update_bench.run_scaling([&](uint id, size_t n) {
+    Thread* current = Thread::current();
+    const uintptr_t base = entries + 1 + (uintptr_t)id * n;
+    for (size_t i = 0; i < n; i++) {
+      BenchmarkCHTLookup lookup(base + i);
+      table->insert(current, lookup, base + i);
+    }
+    for (size_t i = 0; i < n; i++) {
+      BenchmarkCHTLookup lookup(base + i);
+      table->remove(current, lookup);
+    }
+  }, max_benchmark_threads());
+
+  delete table;
+}
+
+TEST_VM(MicroBenchmark, oop_storage_allocate_release) {
+  OopStorage* storage = OopStorage::create("Benchmark Storage", mtGC);
+  MicroBenchmark bench("OopStorage::allocate+release", 100000);
+  bench.run_scaling([&](uint id, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+      oop* entry = storage->allocate();
+      ASSERT_NE(entry, (oop*)nullptr);
+      *entry = nullptr;
+      storage->release(entry);
+    }
+  }, max_benchmark_threads());
+  delete storage;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "utilities/openAddressingHashtable.hpp"
+#include "unittest.hpp"
+
+typedef OpenAddressingHashtable<uintptr_t, uintptr_t, mtTest> SimpleTable;
+
+static unsigned constant_hash(const uintptr_t& k) {
+  return 42;
+}
+
+typedef OpenAddressingHashtable<uintptr_t, uintptr_t, mtTest, constant_hash> CollidingTable;
+
+template <typename T>
+static void fill_and_check(T& table, uintptr_t n) {
+  for (uintptr_t i = 0; i < n; i++) {
+    bool created;
+    uintptr_t* v = table.put_if_absent(i * 8, i, &created);
+    ASSERT_TRUE(created);
+    ASSERT_EQ(*v, i);
+  }
+  ASSERT_EQ(table.number_of_entries(), (unsigned)n);
+  for (uintptr_t i = 0; i < n; i++) {
+    uintptr_t* v = table.get(i * 8);
+    ASSERT_NE(v, (uintptr_t*)nullptr);
+    ASSERT_EQ(*v, i);
+    ASSERT_FALSE(table.contains(i * 8 + 1));
+  }
+}
+
+TEST(OpenAddressingHashtable, empty) {
+  SimpleTable table;
+  EXPECT_EQ(table.number_of_entries(), 0u);
+  EXPECT_EQ(table.get(0), (uintptr_t*)nullptr);
+  EXPECT_FALSE(table.contains(17));
+}
+
+TEST(OpenAddressingHashtable, put_if_absent_keeps_first_value) {
+  SimpleTable table;
+  bool created;
+  *table.put_if_absent(1, 100, &created) += 1;
+  EXPECT_TRUE(created);
+  uintptr_t* v = table.put_if_absent(1, 200, &created);
+  EXPECT_FALSE(created);
+  EXPECT_EQ(*v, 101u);
+  EXPECT_EQ(table.number_of_entries(), 1u);
+}
+
+TEST(OpenAddressingHashtable, grows) {
+  SimpleTable table;
+  unsigned initial_capacity = table.capacity();
+  fill_and_check(table, 100000);
+  EXPECT_GT(table.capacity(), initial_capacity);
+  EXPECT_LE(table.number_of_entries(), table.capacity() - table.capacity() / 8);
+}
+
+TEST(OpenAddressingHashtable, reports_growth) {
+  SimpleTable table;
+  unsigned capacity = table.capacity();
+  unsigned growths = 0;
+  for (uintptr_t i = 0; i < 100000; i++) {
+    bool created;
+    bool grown;
+    table.put_if_absent(i * 8, i, &created, &grown);
+    ASSERT_TRUE(created);
+    ASSERT_EQ(grown, table.capacity() != capacity);
+    if (grown) {
+      growths++;
+      capacity = table.capacity();
+    }
+  }
+  EXPECT_GT(growths, 0u);
+  bool created;
+  bool grown;
+  table.put_if_absent(8, 0, &created, &grown);
+  EXPECT_FALSE(created);
+  EXPECT_FALSE(grown);
+}
+
+TEST(OpenAddressingHashtable, presized) {
+  SimpleTable table(1000);
+  unsigned capacity = table.capacity();
+  fill_and_check(table, 1000);
+  EXPECT_EQ(table.capacity(), capacity);
+}
+
+TEST(OpenAddressingHashtable, collisions) {
+  CollidingTable table;
+  fill_and_check(table, 1000);
+}
+
+TEST(OpenAddressingHashtable, iterate_all) {
+  SimpleTable table;
+  fill_and_check(table, 1000);
+  uintptr_t count = 0;
+  uintptr_t sum = 0;
+  table.iterate_all([&](uintptr_t key, uintptr_t* value) {
+    EXPECT_EQ(key, *value * 8);
+    count++;
+    sum += *value;
+  });
+  EXPECT_EQ(count, 1000u);
+  EXPECT_EQ(sum, 999u * 1000u / 2);
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that C1 with -XX:+C1ShareSpillSlots computes the same results
+ *          for methods with disjoint, overlapping and mixed size spilled
+ *          intervals, that it shrinks the frame when the intervals are
+ *          disjoint, and that it never grows the spill area.
+ * @library /test/lib /
+ * @requires vm.flagless
+ * @requires vm.compiler1.enabled
+ * @run driver compiler.c1.TestShareSpillSlots
+ */
+
+package compiler.c1;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import java.util.Arrays;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+public class TestShareSpillSlots {
+
+    static class Workload {
+        static long call(long x) {
+            return x * 31 + 7;
+        }
+
+        // C1 has no callee saved registers, so every value that is live
+        // across a call is spilled.
+
+        // The a values are dead before the b values are defined, so all
+        // their spill slots can be shared.
+        static long disjoint(long seed) {
+            long a0 = seed * 3 + 1;
+            long a1 = a0 * 5 + 2;
+            long a2 = a1 * 7 + 3;
+            long a3 = a2 * 9 + 4;
+            long a4 = a3 * 11 + 5;
+            long a5 = a4 * 13 + 6;
+            long a6 = a5 * 15 + 7;
+            long a7 = a6 * 17 + 8;
+            long a8 = a7 * 19 + 9;
+            long a9 = a8 * 21 + 10;
+            long a10 = a9 * 23 + 11;
+            long a11 = a10 * 25 + 12;
+            long a12 = a11 * 27 + 13;
+            long a13 = a12 * 29 + 14;
+            long a14 = a13 * 31 + 15;
+            long a15 = a14 * 33 + 16;
+            long x = call(seed);
+            long sumA = a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 +
+                          a12 + a13 + a14 + a15;
+            long b0 = x * 3 + 1;
+            long b1 = b0 * 5 + 2;
+            long b2 = b1 * 7 + 3;
+            long b3 = b2 * 9 + 4;
+            long b4 = b3 * 11 + 5;
+            long b5 = b4 * 13 + 6;
+            long b6 = b5 * 15 + 7;
+            long b7 = b6 * 17 + 8;
+            long b8 = b7 * 19 + 9;
+            long b9 = b8 * 21 + 10;
+            long b10 = b9 * 23 + 11;
+            long b11 = b10 * 25 + 12;
+            long b12 = b11 * 27 + 13;
+            long b13 = b12 * 29 + 14;
+            long b14 = b13 * 31 + 15;
+            long b15 = b14 * 33 + 16;
+            long y = call(x);
+            long sumB = b0 + b1 + b2 + b3 + b4 + b5 + b6 + b7 + b8 + b9 + b10 + b11 +
+                          b12 + b13 + b14 + b15;
+            return sumA ^ sumB ^ y;
+        }
+
+        // The a values are still live when the b values are spilled, so
+        // no spill slot can be shared between them.
+        static long overlapping(long seed) {
+            long a0 = seed * 3 + 1;
+            long a1 = a0 * 5 + 2;
+            long a2 = a1 * 7 + 3;
+            long a3 = a2 * 9 + 4;
+            long a4 = a3 * 11 + 5;
+            long a5 = a4 * 13 + 6;
+            long a6 = a5 * 15 + 7;
+            long a7 = a6 * 17 + 8;
+            long a8 = a7 * 19 + 9;
+            long a9 = a8 * 21 + 10;
+            long a10 = a9 * 23 + 11;
+            long a11 = a10 * 25 + 12;
+            long a12 = a11 * 27 + 13;
+            long a13 = a12 * 29 + 14;
+            long a14 = a13 * 31 + 15;
+            long a15 = a14 * 33 + 16;
+            long x = call(seed);
+            long b0 = x * 3 + 1;
+            long b1 = b0 * 5 + 2;
+            long b2 = b1 * 7 + 3;
+            long b3 = b2 * 9 + 4;
+            long b4 = b3 * 11 + 5;
+            long b5 = b4 * 13 + 6;
+            long b6 = b5 * 15 + 7;
+            long b7 = b6 * 17 + 8;
+            long b8 = b7 * 19 + 9;
+            long b9 = b8 * 21 + 10;
+            long b10 = b9 * 23 + 11;
+            long b11 = b10 * 25 + 12;
+            long b12 = b11 * 27 + 13;
+            long b13 = b12 * 29 + 14;
+            long b14 = b13 * 31 + 15;
+            long b15 = b14 * 33 + 16;
+            long y = call(x);
+            long sumA = a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 +
+                          a12 + a13 + a14 + a15;
+            long sumB = b0 + b1 + b2 + b3 + b4 + b5 + b6 + b7 + b8 + b9 + b10 + b11 +
+                          b12 + b13 + b14 + b15;
+            return sumA ^ sumB ^ y;
+        }
+
+        // Single-word and double-word values with interleaved, overlapping
+        // lifetimes. A relayout in lifetime order would put a double-word
+        // slot after a single-word one and leave alignment holes.
+        static long mixed(long seed) {
+            int i0 = (int) seed * 3 + 1;
+            long l0 = seed * 5 + 2;
+            int i1 = i0 * 7 + 3;
+            double d0 = l0 * 1.5;
+            int i2 = i1 * 9 + 4;
+            long l1 = l0 * 11 + i2;
+            float f0 = i2 * 0.5f;
+            double d1 = d0 * 2.5 + i1;
+            long x = call(seed);
+            int i3 = (int) x * 13 + i0;
+            long l2 = x * 15 + l0;
+            double d2 = d1 * 3.5 + i3;
+            int i4 = i3 * 17 + i2;
+            long y = call(x + i1);
+            long sum1 = i0 + l1 + (long) d0 + i4 + (long) f0;
+            long z = call(y);
+            long sum2 = i1 + i2 + i3 + l0 + l2 + (long) d1 + (long) d2;
+            return sum1 ^ sum2 ^ z;
+        }
+
+        public static void main(String[] args) {
+            final long expectedDisjoint = disjoint(42);
+            final long expectedOverlapping = overlapping(42);
+            final long expectedMixed = mixed(42);
+            for (int i = 0; i < 20_000; i++) {
+                if (disjoint(42) != expectedDisjoint) {
+                    throw new RuntimeException("disjoint: wrong result");
+                }
+                if (overlapping(42) != expectedOverlapping) {
+                    throw new RuntimeException("overlapping: wrong result");
+                }
+                if (mixed(42) != expectedMixed) {
+                    throw new RuntimeException("mixed: wrong result");
+                }
+            }
+        }
+    }
+
+    // C1 spill slots 40 -> 24, frame size 208 bytes: compiler.c1.TestShareSpillSlots$Workload::disjoint
+    private static final Pattern SPILL_LINE =
+        Pattern.compile("C1 spill slots (\\d+) -> (\\d+), frame size (\\d+) bytes: \\S*Workload::(\\w+)");
+
+    private static final String[] METHODS = { "disjoint", "overlapping", "mixed" };
+
+    private static class Result {
+        int slotsBefore;
+        int slotsAfter;
+        int frameSize;
+
+        @Override
+        public String toString() {
+            return "spill slots " + slotsBefore + " -> " + slotsAfter + ", frame size " + frameSize + " bytes";
+        }
+    }
+
+    private static Result[] run(boolean share) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:TieredStopAtLevel=1",
+            "-Xbatch",
+            "-XX:-Inline",
+            "-XX:+UnlockExperimentalVMOptions",
+            share ? "-XX:+C1ShareSpillSlots" : "-XX:-C1ShareSpillSlots",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + Workload.class.getName() + "::*",
+            "-Xlog:jit+compilation=debug",
+            Workload.class.getName());
+        output.shouldHaveExitValue(0);
+
+        // indexed like METHODS
+        Result[] results = new Result[METHODS.length];
+        for (String line : output.asLines()) {
+            Matcher m = SPILL_LINE.matcher(line);
+            if (!m.find()) {
+                continue;
+            }
+            int index = Arrays.asList(METHODS).indexOf(m.group(4));
+            if (index < 0) {
+                continue;
+            }
+            Result r = new Result();
+            r.slotsBefore = Integer.parseInt(m.group(1));
+            r.slotsAfter = Integer.parseInt(m.group(2));
+            r.frameSize = Integer.parseInt(m.group(3));
+            results[index] = r;
+        }
+        for (int i = 0; i < results.length; i++) {
+            if (results[i] == null) {
+                throw new RuntimeException("No spill slot log line for " + METHODS[i]);
+            }
+        }
+        return results;
+    }
+
+    public static void main(String[] args) throws Exception {
+        Result[] baseline = run(false);
+        Result[] shared = run(true);
+
+        for (int i = 0; i < METHODS.length; i++) {
+            System.out.println(METHODS[i] + ": -C1ShareSpillSlots " + baseline[i] + ", +C1ShareSpillSlots " + shared[i]);
+        }
+
+        for (Result r : baseline) {
+            if (r.slotsAfter != r.slotsBefore) {
+                throw new RuntimeException("Spill slots shared without -XX:+C1ShareSpillSlots: " + r);
+            }
+        }
+        for (int i = 0; i < METHODS.length; i++) {
+            if (shared[i].slotsAfter > shared[i].slotsBefore ||
+                shared[i].frameSize > baseline[i].frameSize) {
+                throw new RuntimeException(METHODS[i] + ": spill area grew: " + baseline[i] + " vs " + shared[i]);
+            }
+        }
+        if (shared[0].slotsAfter >= shared[0].slotsBefore) {
+            throw new RuntimeException("Disjoint spill slots were not shared: " + shared[0]);
+        }
+        if (shared[0].frameSize >= baseline[0].frameSize) {
+            throw new RuntimeException("Frame did not shrink: " + baseline[0] + " vs " + shared[0]);
+        }
+        // 16 long values, two slots each, are live across the second call
+        if (shared[1].slotsAfter < 2 * 16) {
+            throw new RuntimeException("Overlapping spill slots were shared: " + shared[1]);
+        }
+    }
+}
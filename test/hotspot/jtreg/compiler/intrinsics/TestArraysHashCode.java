@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Compare the hash codes computed by the vectorizedHashCode intrinsic
+ *          with a plain Java loop for every element type it supports.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   compiler.intrinsics.TestArraysHashCode
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorizedHashCodeIntrinsic
+ *                   compiler.intrinsics.TestArraysHashCode
+ */
+
+package compiler.intrinsics;
+
+import java.util.Arrays;
+import java.util.Random;
+
+public class TestArraysHashCode {
+    // Lengths 0-9 cover the tail loop with and without a pass through the
+    // unrolled main loop, the large ones cover long runs of the main loop.
+    private static final int[] LENGTHS = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+                                           31, 32, 33, 100, 1000, 10007 };
+
+    private static final int WARMUP = 20_000;
+
+    private static final Random RANDOM = new Random(42);
+
+    static int expected(byte[] a) {
+        int h = 1;
+        for (byte e : a) {
+            h = 31 * h + e;
+        }
+        return h;
+    }
+
+    static int expected(char[] a) {
+        int h = 1;
+        for (char e : a) {
+            h = 31 * h + e;
+        }
+        return h;
+    }
+
+    static int expected(short[] a) {
+        int h = 1;
+        for (short e : a) {
+            h = 31 * h + e;
+        }
+        return h;
+    }
+
+    static int expected(int[] a) {
+        int h = 1;
+        for (int e : a) {
+            h = 31 * h + e;
+        }
+        return h;
+    }
+
+    // String.hashCode starts from 0 and reads Latin1 bytes as unsigned
+    static int expected(String s) {
+        int h = 0;
+        for (int i = 0; i < s.length(); i++) {
+            h = 31 * h + s.charAt(i);
+        }
+        return h;
+    }
+
+    static int hash(byte[] a)  { return Arrays.hashCode(a); }
+    static int hash(char[] a)  { return Arrays.hashCode(a); }
+    static int hash(short[] a) { return Arrays.hashCode(a); }
+    static int hash(int[] a)   { return Arrays.hashCode(a); }
+
+    // Fresh strings, String caches its hash code
+    static int hashLatin1(char[] a) { return new String(a).hashCode(); }
+    static int hashUTF16(char[] a)  { return new String(a).hashCode(); }
+
+    static void check(String what, int length, int expected, int actual) {
+        if (expected != actual) {
+            throw new RuntimeException(what + " of length " + length + ": expected " +
+                                       expected + ", got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int length : LENGTHS) {
+            byte[] bytes = new byte[length];
+            char[] chars = new char[length];
+            char[] latin1 = new char[length];
+            short[] shorts = new short[length];
+            int[] ints = new int[length];
+            for (int i = 0; i < length; i++) {
+                int next = RANDOM.nextInt();
+                bytes[i] = (byte) next;
+                // Random values have the sign bit set for about half of
+                // the elements of each width. The chars are kept above
+                // 0xff so that new String(chars) is a UTF16 string.
+                chars[i] = (char) (next | 0x100);
+                latin1[i] = (char) (next & 0xff);
+                shorts[i] = (short) next;
+                ints[i] = next;
+            }
+
+            for (int i = 0; i < WARMUP; i++) {
+                check("byte[]", length, expected(bytes), hash(bytes));
+                check("char[]", length, expected(chars), hash(chars));
+                check("short[]", length, expected(shorts), hash(shorts));
+                check("int[]", length, expected(ints), hash(ints));
+                String s = new String(latin1);
+                check("Latin1 String", length, expected(s), hashLatin1(latin1));
+                s = new String(chars);
+                check("UTF16 String", length, expected(s), hashUTF16(chars));
+                if (length > 1000) {
+                    // The shorter lengths already got the methods compiled
+                    break;
+                }
+            }
+        }
+    }
+}
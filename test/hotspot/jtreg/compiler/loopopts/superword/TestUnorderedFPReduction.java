@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Check that float and double add/mul reductions are moved out of
+ *          the loop with -XX:+UseUnorderedFPReductions.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestUnorderedFPReduction
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+
+public class TestUnorderedFPReduction {
+    static final int RANGE = 1024;
+    static final int REPETITIONS = 10;
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions",
+                                   "-XX:+UseUnorderedFPReductions");
+    }
+
+    // The inputs are small integral values, so partial sums and products
+    // are exact and the reassociated result must match the interpreter.
+
+    @Run(test = {"sumF", "mulF", "sumD", "mulD"})
+    @Warmup(0)
+    public static void runTests() throws Exception {
+        float[] af = new float[RANGE];
+        double[] ad = new double[RANGE];
+        float[] mf = new float[RANGE];
+        double[] md = new double[RANGE];
+        for (int i = 0; i < RANGE; i++) {
+            af[i] = i % 7;
+            ad[i] = i % 11;
+            // Products of +-1 and a few 2s stay exact.
+            mf[i] = (i % 64 == 0) ? 2.0f : ((i % 3 == 0) ? -1.0f : 1.0f);
+            md[i] = (i % 64 == 0) ? 2.0d : ((i % 3 == 0) ? -1.0d : 1.0d);
+        }
+        float goldSumF = 0.0f;
+        double goldSumD = 0.0d;
+        float goldMulF = 1.0f;
+        double goldMulD = 1.0d;
+        for (int i = 0; i < RANGE; i++) {
+            goldSumF += af[i];
+            goldSumD += ad[i];
+            goldMulF *= mf[i];
+            goldMulD *= md[i];
+        }
+        for (int j = 0; j < REPETITIONS; j++) {
+            check("sumF", goldSumF, sumF(af));
+            check("sumD", goldSumD, sumD(ad));
+            check("mulF", goldMulF, mulF(mf));
+            check("mulD", goldMulD, mulD(md));
+        }
+    }
+
+    static void check(String name, double expected, double actual) {
+        if (expected != actual) {
+            throw new RuntimeException("Wrong result for " + name + ": " + actual + " != " + expected);
+        }
+    }
+
+    // Without the flag every unrolled iteration does an ordered reduction.
+    // With the flag the loop accumulates with plain vector ops and only the
+    // post-loop reduction remains.
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_F,    IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_VF,           IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_REDUCTION_VF,                         "> 0",
+                  IRNode.ADD_REDUCTION_VF,                         "<= 2"}, // one per main loop
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    static float sumF(float[] a) {
+        float sum = 0.0f;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_D,    IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_VD,           IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_REDUCTION_VD,                         "> 0",
+                  IRNode.ADD_REDUCTION_VD,                         "<= 2"}, // one per main loop
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    static double sumD(double[] a) {
+        double sum = 0.0d;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_F,    IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.MUL_VF,           IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.MUL_REDUCTION_VF,                         "> 0",
+                  IRNode.MUL_REDUCTION_VF,                         "<= 2"}, // one per main loop
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    static float mulF(float[] a) {
+        float prod = 1.0f;
+        for (int i = 0; i < a.length; i++) {
+            prod *= a[i];
+        }
+        return prod;
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_D,    IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.MUL_VD,           IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.MUL_REDUCTION_VD,                         "> 0",
+                  IRNode.MUL_REDUCTION_VD,                         "<= 2"}, // one per main loop
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        applyIf = {"SuperWordReductions", "true"})
+    static double mulD(double[] a) {
+        double prod = 1.0d;
+        for (int i = 0; i < a.length; i++) {
+            prod *= a[i];
+        }
+        return prod;
+    }
+}
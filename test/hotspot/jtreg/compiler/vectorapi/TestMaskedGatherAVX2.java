@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that masked gathers of int, long, float and double vectors
+ *          are intrinsified with AVX2 only and compute the right lanes.
+ * @requires vm.compiler2.enabled
+ * @requires (os.arch == "x86_64" | os.arch == "amd64") & vm.cpu.features ~= ".*avx2.*"
+ * @library /test/lib /
+ * @modules jdk.incubator.vector
+ * @run driver compiler.vectorapi.TestMaskedGatherAVX2
+ */
+
+package compiler.vectorapi;
+
+import compiler.lib.ir_framework.*;
+
+import jdk.incubator.vector.DoubleVector;
+import jdk.incubator.vector.FloatVector;
+import jdk.incubator.vector.IntVector;
+import jdk.incubator.vector.LongVector;
+import jdk.incubator.vector.VectorMask;
+import jdk.incubator.vector.VectorSpecies;
+
+public class TestMaskedGatherAVX2 {
+    private static final VectorSpecies<Integer> I_SPECIES = IntVector.SPECIES_256;
+    private static final VectorSpecies<Long>    L_SPECIES = LongVector.SPECIES_256;
+    private static final VectorSpecies<Float>   F_SPECIES = FloatVector.SPECIES_256;
+    private static final VectorSpecies<Double>  D_SPECIES = DoubleVector.SPECIES_256;
+
+    private static final int SIZE = 64;
+
+    private static final int[] ia = new int[SIZE];
+    private static final long[] la = new long[SIZE];
+    private static final float[] fa = new float[SIZE];
+    private static final double[] da = new double[SIZE];
+    private static final int[] indices = new int[I_SPECIES.length()];
+    private static final boolean[] lanes = new boolean[I_SPECIES.length()];
+
+    private static final int[] ir = new int[I_SPECIES.length()];
+    private static final long[] lr = new long[L_SPECIES.length()];
+    private static final float[] fr = new float[F_SPECIES.length()];
+    private static final double[] dr = new double[D_SPECIES.length()];
+
+    static {
+        for (int i = 0; i < SIZE; i++) {
+            ia[i] = i * 3 + 1;
+            la[i] = i * 5L + 2;
+            fa[i] = i * 7.0f + 3;
+            da[i] = i * 11.0 + 4;
+        }
+        for (int i = 0; i < indices.length; i++) {
+            indices[i] = (i * 13 + 5) % SIZE;
+            lanes[i] = (i % 3) != 1;
+        }
+    }
+
+    public static void main(String[] args) {
+        // -XX:UseAVX=2 disables the AVX-512 features, so the gathers must be
+        // matched by the AVX2 rule, which takes the mask in a vector register.
+        TestFramework.runWithFlags("--add-modules=jdk.incubator.vector", "-XX:UseAVX=2");
+    }
+
+    @Test
+    @IR(counts = { IRNode.LOAD_VECTOR_GATHER_MASKED, "= 1" }, applyIfCPUFeature = {"avx2", "true"})
+    public static void gatherInt() {
+        VectorMask<Integer> m = VectorMask.fromArray(I_SPECIES, lanes, 0);
+        IntVector.fromArray(I_SPECIES, ia, 0, indices, 0, m).intoArray(ir, 0);
+    }
+
+    @Check(test = "gatherInt")
+    public static void checkInt() {
+        for (int i = 0; i < ir.length; i++) {
+            int expected = lanes[i] ? ia[indices[i]] : 0;
+            if (ir[i] != expected) {
+                throw new RuntimeException("int lane " + i + ": " + ir[i] + " != " + expected);
+            }
+        }
+    }
+
+    @Test
+    @IR(counts = { IRNode.LOAD_VECTOR_GATHER_MASKED, "= 1" }, applyIfCPUFeature = {"avx2", "true"})
+    public static void gatherLong() {
+        VectorMask<Long> m = VectorMask.fromArray(L_SPECIES, lanes, 0);
+        LongVector.fromArray(L_SPECIES, la, 0, indices, 0, m).intoArray(lr, 0);
+    }
+
+    @Check(test = "gatherLong")
+    public static void checkLong() {
+        for (int i = 0; i < lr.length; i++) {
+            long expected = lanes[i] ? la[indices[i]] : 0;
+            if (lr[i] != expected) {
+                throw new RuntimeException("long lane " + i + ": " + lr[i] + " != " + expected);
+            }
+        }
+    }
+
+    @Test
+    @IR(counts = { IRNode.LOAD_VECTOR_GATHER_MASKED, "= 1" }, applyIfCPUFeature = {"avx2", "true"})
+    public static void gatherFloat() {
+        VectorMask<Float> m = VectorMask.fromArray(F_SPECIES, lanes, 0);
+        FloatVector.fromArray(F_SPECIES, fa, 0, indices, 0, m).intoArray(fr, 0);
+    }
+
+    @Check(test = "gatherFloat")
+    public static void checkFloat() {
+        for (int i = 0; i < fr.length; i++) {
+            float expected = lanes[i] ? fa[indices[i]] : 0;
+            if (fr[i] != expected) {
+                throw new RuntimeException("float lane " + i + ": " + fr[i] + " != " + expected);
+            }
+        }
+    }
+
+    @Test
+    @IR(counts = { IRNode.LOAD_VECTOR_GATHER_MASKED, "= 1" }, applyIfCPUFeature = {"avx2", "true"})
+    public static void gatherDouble() {
+        VectorMask<Double> m = VectorMask.fromArray(D_SPECIES, lanes, 0);
+        DoubleVector.fromArray(D_SPECIES, da, 0, indices, 0, m).intoArray(dr, 0);
+    }
+
+    @Check(test = "gatherDouble")
+    public static void checkDouble() {
+        for (int i = 0; i < dr.length; i++) {
+            double expected = lanes[i] ? da[indices[i]] : 0;
+            if (dr[i] != expected) {
+                throw new RuntimeException("double lane " + i + ": " + dr[i] + " != " + expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEagerReclaimHumongousObjArrays
+ * @summary Test to make sure that humongous object arrays that have been referenced
+ * by old gen regions and that reference other objects themselves are eagerly reclaimed
+ * with -XX:+G1EagerReclaimHumongousObjArrays, avoiding Full GCs.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver gc.g1.TestEagerReclaimHumongousObjArrays
+ */
+
+import java.util.regex.Pattern;
+import java.util.regex.Matcher;
+import java.util.LinkedList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import static jdk.test.lib.Asserts.*;
+
+class ObjArrayRefHolder {
+  Object[] ref;
+}
+
+class TestEagerReclaimHumongousObjArraysReclaimRegionFast {
+
+    public static final int M = 1024*1024;
+
+    public static LinkedList<Object> garbageList = new LinkedList<Object>();
+
+    public static void genGarbage() {
+        for (int i = 0; i < 32*1024; i++) {
+            garbageList.add(new int[100]);
+        }
+        garbageList.clear();
+    }
+
+    // Old gen objects referenced by the large object arrays.
+    static Object[] referents = new Object[1024];
+
+    // Old gen object referencing the large object array, generating remembered
+    // set entries.
+    static ObjArrayRefHolder fromOld = new ObjArrayRefHolder();
+
+    public static void main(String[] args) {
+        for (int i = 0; i < referents.length; i++) {
+            referents[i] = new Object();
+        }
+
+        for (int i = 0; i < 100; i++) {
+            // A large object array that will be reclaimed eagerly.
+            Object[] large = new Object[3*M];
+            for (int j = 0; j < large.length; j += 1024) {
+                large[j] = referents[(j / 1024) % referents.length];
+            }
+            fromOld.ref = large;
+            genGarbage();
+        }
+    }
+}
+
+public class TestEagerReclaimHumongousObjArrays {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseG1GC",
+            "-Xms128M",
+            "-Xmx128M",
+            "-Xmn16M",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+G1EagerReclaimHumongousObjArrays",
+            "-Xlog:gc,gc+humongous=debug",
+            TestEagerReclaimHumongousObjArraysReclaimRegionFast.class.getName());
+
+        Pattern p = Pattern.compile("Full GC");
+
+        int found = 0;
+        Matcher m = p.matcher(output.getStdout());
+        while (m.find()) {
+            found++;
+        }
+        System.out.println("Issued " + found + " Full GCs");
+
+        assertLessThan(found, 10, "Found that " + found + " Full GCs were issued. This is larger than the bound. Eager reclaim of humongous object arrays seems to not work at all");
+        output.shouldMatch("Eagerly reclaimed [1-9][0-9]* humongous objects \\([1-9][0-9]* object arrays\\)");
+        output.shouldHaveExitValue(0);
+    }
+}
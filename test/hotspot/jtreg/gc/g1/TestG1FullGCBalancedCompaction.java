@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test id=default
+ * @summary Check that the objects survive G1 full gcs with intact contents
+ *          on a fragmented heap with interleaved humongous objects.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m
+ *                   -XX:ParallelGCThreads=4 -XX:-UseDynamicNumberOfGCThreads
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC
+ *                   -Xlog:gc=info
+ *                   gc.g1.TestG1FullGCBalancedCompaction
+ */
+
+/*
+ * @test id=balanced
+ * @summary Same as the default variant, but with workers taking over
+ *          compaction regions from other workers' queues.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m
+ *                   -XX:ParallelGCThreads=4 -XX:-UseDynamicNumberOfGCThreads
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+G1FullGCBalancedCompaction
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC
+ *                   -Xlog:gc=info
+ *                   gc.g1.TestG1FullGCBalancedCompaction
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+
+public class TestG1FullGCBalancedCompaction {
+
+    static class Node {
+        final int id;
+        final byte[] payload;
+        Node next;
+
+        Node(int id, int size) {
+            this.id = id;
+            this.payload = new byte[size];
+            for (int i = 0; i < size; i++) {
+                payload[i] = (byte) (id + i);
+            }
+        }
+
+        void verify() {
+            for (int i = 0; i < payload.length; i++) {
+                if (payload[i] != (byte) (id + i)) {
+                    throw new RuntimeException("Node " + id + " corrupted at " + i);
+                }
+            }
+        }
+    }
+
+    private static final int NODES = 40_000;
+    private static final int HUMONGOUS_SIZE = 600 * 1024;
+    private static final int ROUNDS = 10;
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        Node[] nodes = new Node[NODES];
+        List<byte[]> humongous = new ArrayList<>();
+        for (int i = 0; i < NODES; i++) {
+            nodes[i] = new Node(i, 16 + random.nextInt(256));
+            nodes[i].next = nodes[random.nextInt(i + 1)];
+            if (i % 4000 == 0) {
+                humongous.add(new byte[HUMONGOUS_SIZE]);
+            }
+        }
+
+        for (int round = 0; round < ROUNDS; round++) {
+            // Free a random half of the nodes to fragment every region,
+            // so that the full gc has live objects to move everywhere
+            for (int i = 0; i < NODES; i++) {
+                if (random.nextBoolean()) {
+                    nodes[i] = new Node(i, 16 + random.nextInt(256));
+                    nodes[i].next = nodes[random.nextInt(NODES)];
+                }
+            }
+            if (!humongous.isEmpty()) {
+                humongous.remove(random.nextInt(humongous.size()));
+            }
+            humongous.add(new byte[HUMONGOUS_SIZE]);
+
+            System.gc();
+
+            for (int i = 0; i < NODES; i++) {
+                Node n = nodes[i];
+                if (n == null || n.id != i) {
+                    throw new RuntimeException("Node " + i + " lost");
+                }
+                n.verify();
+                if (n.next != null) {
+                    n.next.verify();
+                }
+            }
+        }
+    }
+}
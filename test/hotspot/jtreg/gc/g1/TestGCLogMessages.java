@@ -143,6 +143,7 @@ public boolean isAvailable() {
         new LogMessageWithLevel("Scanned Blocks:", Level.DEBUG),
         new LogMessageWithLevel("Claimed Chunks:", Level.DEBUG),
         new LogMessageWithLevel("Found Roots:", Level.DEBUG),
+        new LogMessageWithLevel("Prefetched Blocks:", Level.DEBUG),
         // Code Roots Scan
         new LogMessageWithLevel("Code Root Scan \\(ms\\):", Level.DEBUG),
         // Object Copy
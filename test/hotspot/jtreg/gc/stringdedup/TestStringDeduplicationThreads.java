@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.stringdedup;
+
+/*
+ * @test id=G1
+ * @summary Test string deduplication with multiple processing threads.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc:open
+ *          java.base/java.lang:open
+ *          java.management
+ * @run driver gc.stringdedup.TestStringDeduplicationThreads G1
+ */
+
+/*
+ * @test id=Parallel
+ * @summary Test string deduplication with multiple processing threads.
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc:open
+ *          java.base/java.lang:open
+ *          java.management
+ * @run driver gc.stringdedup.TestStringDeduplicationThreads Parallel
+ */
+
+/*
+ * @test id=Z
+ * @summary Test string deduplication with multiple processing threads.
+ * @requires vm.gc.Z
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc:open
+ *          java.base/java.lang:open
+ *          java.management
+ * @run driver gc.stringdedup.TestStringDeduplicationThreads Z
+ */
+
+import java.lang.reflect.Field;
+import java.util.ArrayList;
+import java.util.IdentityHashMap;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStringDeduplicationThreads {
+    // Number of distinct strings, and copies of each.
+    private static final int DISTINCT = 20_000;
+    private static final int COPIES = 4;
+    private static final long TIMEOUT_MS = 60_000;
+
+    public static void main(String[] args) throws Exception {
+        String gc = "-XX:+Use" + args[0] + "GC";
+        // Plain run, and with frequent resizing so that the pre-sizing of
+        // the table overlaps with requests arriving from the GC.
+        runTest(gc, "-XX:+UnlockDiagnosticVMOptions", "-XX:-StringDeduplicationResizeALot");
+        runTest(gc, "-XX:+UnlockDiagnosticVMOptions", "-XX:+StringDeduplicationResizeALot");
+    }
+
+    private static void runTest(String... extraArgs) throws Exception {
+        List<String> args = new ArrayList<>();
+        for (String a : extraArgs) {
+            args.add(a);
+        }
+        args.add("-Xmx256m");
+        args.add("-XX:+UseStringDeduplication");
+        args.add("-XX:StringDeduplicationAgeThreshold=1");
+        args.add("-XX:+UnlockExperimentalVMOptions");
+        args.add("-XX:StringDeduplicationThreads=4");
+        args.add("-Xlog:stringdedup=debug");
+        args.add("--add-opens=java.base/java.lang=ALL-UNNAMED");
+        args.add(Child.class.getName());
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(args);
+        output.shouldHaveExitValue(0);
+        // Every processing thread reports its throughput.
+        for (int i = 0; i < 4; i++) {
+            output.shouldMatch("Thread " + i + ": [0-9]+ inspected");
+        }
+        output.shouldContain("All strings deduplicated");
+    }
+
+    public static class Child {
+        private static Field valueField;
+
+        private static Object getValue(String s) throws Exception {
+            return valueField.get(s);
+        }
+
+        private static String makeString(int i) {
+            // A new value array for every copy.
+            return new String(("dedup-test-" + i).toCharArray());
+        }
+
+        private static void collectGarbage() {
+            // Allocate enough to cause several young collections, so that
+            // the strings age past the threshold and dedup requests are
+            // made, then nudge with an explicit GC.
+            for (int i = 0; i < 1_000_000; i++) {
+                blackhole = new byte[64];
+            }
+            System.gc();
+        }
+
+        static volatile Object blackhole;
+
+        public static void main(String[] args) throws Exception {
+            valueField = String.class.getDeclaredField("value");
+            valueField.setAccessible(true);
+
+            String[][] strings = new String[DISTINCT][COPIES];
+            for (int i = 0; i < DISTINCT; i++) {
+                for (int j = 0; j < COPIES; j++) {
+                    strings[i][j] = makeString(i);
+                }
+            }
+
+            long deadline = System.currentTimeMillis() + TIMEOUT_MS;
+            int remaining;
+            do {
+                collectGarbage();
+                Thread.sleep(100);
+                remaining = 0;
+                for (int i = 0; i < DISTINCT; i++) {
+                    if (countDistinctValues(strings[i]) != 1) {
+                        remaining++;
+                    }
+                }
+                System.out.println("Groups not yet deduplicated: " + remaining);
+            } while (remaining > 0 && System.currentTimeMillis() < deadline);
+
+            // Concurrent processing must not corrupt any string.
+            for (int i = 0; i < DISTINCT; i++) {
+                String expected = "dedup-test-" + i;
+                for (int j = 0; j < COPIES; j++) {
+                    if (!expected.equals(strings[i][j])) {
+                        throw new RuntimeException("Corrupted string: " + strings[i][j] + " != " + expected);
+                    }
+                }
+            }
+            if (remaining > 0) {
+                throw new RuntimeException(remaining + " groups were not deduplicated");
+            }
+            System.out.println("All strings deduplicated");
+        }
+
+        private static int countDistinctValues(String[] group) throws Exception {
+            IdentityHashMap<Object, Boolean> values = new IdentityHashMap<>();
+            for (String s : group) {
+                values.put(getValue(s), Boolean.TRUE);
+            }
+            return values.size();
+        }
+    }
+}
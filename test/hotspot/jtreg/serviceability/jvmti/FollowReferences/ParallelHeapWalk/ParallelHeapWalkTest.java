@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=serial
+ * @summary Verifies that FollowReferences reports every reference of an object
+ *     graph and applies the tags set by the callbacks, and prints the time
+ *     of the heap walk so that the serial and parallel modes can be compared.
+ *     The serial walk shows a tag to the callbacks as soon as it is set, the
+ *     parallel walk applies the tags when the walk completes.
+ * @requires vm.jvmti
+ * @run main/othervm/native -agentlib:ParallelHeapWalkTest ParallelHeapWalkTest serial
+ */
+
+/*
+ * @test id=parallel-G1
+ * @requires vm.jvmti & vm.gc.G1
+ * @run main/othervm/native -agentlib:ParallelHeapWalkTest
+ *     -XX:+UseG1GC -XX:ParallelGCThreads=4 -XX:-UseDynamicNumberOfGCThreads
+ *     -XX:+UnlockExperimentalVMOptions -XX:+JvmtiParallelHeapWalk
+ *     -Xlog:jvmti=debug ParallelHeapWalkTest parallel
+ */
+
+/*
+ * @test id=parallel-Z
+ * @requires vm.jvmti & vm.gc.Z
+ * @run main/othervm/native -agentlib:ParallelHeapWalkTest
+ *     -XX:+UseZGC -XX:ParallelGCThreads=4 -XX:-UseDynamicNumberOfGCThreads
+ *     -XX:+UnlockExperimentalVMOptions -XX:+JvmtiParallelHeapWalk
+ *     -Xlog:jvmti=debug ParallelHeapWalkTest parallel
+ */
+
+import java.util.Random;
+
+public class ParallelHeapWalkTest {
+    static {
+        System.loadLibrary("ParallelHeapWalkTest");
+    }
+
+    static class Node {
+        Node left;
+        Node right;
+        Node link;
+    }
+
+    private static final int NODE_COUNT = 500_000;
+    private static final int ITERATIONS = 10;
+
+    // tags the Node class, the callback only follows references to nodes
+    private static native void prepare(Class<?> nodeClass);
+
+    // returns the number of references reported to the callback,
+    // and tags every reported node if tagNodes is set
+    private static native long walk(Object root, boolean tagNodes);
+
+    // returns the number of references that the last walk reported for
+    // a node that already had a non-zero tag
+    private static native long taggedReports();
+
+    // returns the number of nodes with a non-zero tag
+    private static native int countTagged(Node[] nodes);
+
+    public static void main(String[] args) {
+        boolean parallel = args[0].equals("parallel");
+        Random random = new Random(42);
+        Node[] nodes = new Node[NODE_COUNT];
+        for (int i = 0; i < NODE_COUNT; i++) {
+            nodes[i] = new Node();
+        }
+        long expectedReferences = NODE_COUNT;
+        for (int i = 0; i < NODE_COUNT; i++) {
+            Node node = nodes[i];
+            if (2 * i + 1 < NODE_COUNT) {
+                node.left = nodes[2 * i + 1];
+                expectedReferences++;
+            }
+            if (2 * i + 2 < NODE_COUNT) {
+                node.right = nodes[2 * i + 2];
+                expectedReferences++;
+            }
+            // cross links make objects reachable from several workers
+            if (random.nextInt(4) == 0) {
+                node.link = nodes[random.nextInt(NODE_COUNT)];
+                expectedReferences++;
+            }
+        }
+
+        prepare(Node.class);
+
+        long references = walk(nodes, false);
+        if (references != expectedReferences) {
+            throw new RuntimeException("Expected " + expectedReferences + " references, got " + references);
+        }
+
+        long start = System.nanoTime();
+        for (int i = 0; i < ITERATIONS; i++) {
+            walk(nodes, false);
+        }
+        long elapsed = System.nanoTime() - start;
+        System.out.printf("FollowReferences: %d references, %.3f ms per walk%n",
+                          references, elapsed / 1e6 / ITERATIONS);
+
+        references = walk(nodes, true);
+        if (references != expectedReferences) {
+            throw new RuntimeException("Expected " + expectedReferences + " references, got " + references);
+        }
+        int tagged = countTagged(nodes);
+        if (tagged != NODE_COUNT) {
+            throw new RuntimeException("Expected " + NODE_COUNT + " tagged nodes, got " + tagged);
+        }
+
+        // Every node is reported once per incoming reference and tagged at
+        // its first report. The serial walk shows that tag to the later
+        // reports. The parallel walk defers the tag updates to the end of
+        // the walk, so all reports of an untagged node see tag 0.
+        long expectedTaggedReports = parallel ? 0 : expectedReferences - NODE_COUNT;
+        long taggedReports = taggedReports();
+        System.out.println("Reports of already tagged nodes: " + taggedReports);
+        if (taggedReports != expectedTaggedReports) {
+            throw new RuntimeException("Expected " + expectedTaggedReports +
+                                       " reports of already tagged nodes, got " + taggedReports);
+        }
+    }
+}
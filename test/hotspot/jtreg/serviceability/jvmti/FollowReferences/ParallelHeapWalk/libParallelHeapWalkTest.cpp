@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <atomic>
+#include <string.h>
+#include "jvmti.h"
+#include "jvmti_common.hpp"
+
+extern "C" {
+
+static jvmtiEnv* jvmti = nullptr;
+
+static const jlong NODE_CLASS_TAG = 1;
+
+// The callback may be invoked concurrently with -XX:+JvmtiParallelHeapWalk.
+static std::atomic<jlong> reference_count;
+static std::atomic<jlong> tagged_report_count;
+static std::atomic<jlong> next_tag;
+static bool tag_nodes = false;
+
+static jint JNICALL
+heap_reference_callback(jvmtiHeapReferenceKind reference_kind,
+                        const jvmtiHeapReferenceInfo* reference_info,
+                        jlong class_tag,
+                        jlong referrer_class_tag,
+                        jlong size,
+                        jlong* tag_ptr,
+                        jlong* referrer_tag_ptr,
+                        jint length,
+                        void* user_data) {
+  if (class_tag != NODE_CLASS_TAG) {
+    return 0;
+  }
+  reference_count++;
+  if (*tag_ptr != 0) {
+    tagged_report_count++;
+  } else if (tag_nodes) {
+    *tag_ptr = ++next_tag;
+  }
+  return JVMTI_VISIT_OBJECTS;
+}
+
+JNIEXPORT jint JNICALL Agent_OnLoad(JavaVM *jvm, char *options, void *reserved) {
+  jint res = jvm->GetEnv((void **)&jvmti, JVMTI_VERSION_1_1);
+  if (res != JNI_OK || jvmti == nullptr) {
+    printf("jvm->GetEnv failed\n");
+    fflush(nullptr);
+    return JNI_ERR;
+  }
+
+  jvmtiCapabilities caps;
+  memset(&caps, 0, sizeof(caps));
+  caps.can_tag_objects = 1;
+  jvmtiError err = jvmti->AddCapabilities(&caps);
+  if (err != JVMTI_ERROR_NONE) {
+    printf("AddCapabilities failed: %s (%d)\n", TranslateError(err), err);
+    fflush(nullptr);
+    return JNI_ERR;
+  }
+
+  return JNI_OK;
+}
+
+JNIEXPORT void JNICALL
+Java_ParallelHeapWalkTest_prepare(JNIEnv* env, jclass cls, jclass node_class) {
+  check_jvmti_status(env,
+    jvmti->SetTag(node_class, NODE_CLASS_TAG),
+    "SetTag failed");
+}
+
+JNIEXPORT jlong JNICALL
+Java_ParallelHeapWalkTest_walk(JNIEnv* env, jclass cls, jobject root, jboolean tag) {
+  jvmtiHeapCallbacks callbacks;
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.heap_reference_callback = heap_reference_callback;
+
+  reference_count = 0;
+  tagged_report_count = 0;
+  tag_nodes = (tag == JNI_TRUE);
+  check_jvmti_status(env,
+    jvmti->FollowReferences(0, nullptr, root, &callbacks, nullptr),
+    "FollowReferences failed");
+  return reference_count;
+}
+
+JNIEXPORT jlong JNICALL
+Java_ParallelHeapWalkTest_taggedReports(JNIEnv* env, jclass cls) {
+  return tagged_report_count;
+}
+
+JNIEXPORT jint JNICALL
+Java_ParallelHeapWalkTest_countTagged(JNIEnv* env, jclass cls, jobjectArray nodes) {
+  jint count = 0;
+  jsize length = env->GetArrayLength(nodes);
+  for (jsize i = 0; i < length; i++) {
+    jobject node = env->GetObjectArrayElement(nodes, i);
+    jlong tag = 0;
+    check_jvmti_status(env,
+      jvmti->GetTag(node, &tag),
+      "GetTag failed");
+    if (tag != 0) {
+      count++;
+    }
+    env->DeleteLocalRef(node);
+  }
+  return count;
+}
+
+}
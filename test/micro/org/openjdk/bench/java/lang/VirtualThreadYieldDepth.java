@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.java.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OperationsPerInvocation;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the latency of a virtual thread yield as a function of the
+ * depth of the virtual thread's stack.
+ *
+ * Every yield freezes the frames that were thawed since the previous yield
+ * and thaws them again when the thread is rescheduled. Deep stacks are only
+ * partially thawed, with the remaining frames thawed lazily through the
+ * return barrier, so the cost per yield should stay mostly flat as the
+ * depth grows.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgsAppend = {"-Djdk.virtualThreadScheduler.parallelism=1"})
+public class VirtualThreadYieldDepth {
+
+    private static final int YIELDS = 10_000;
+
+    @Param({"1", "10", "100", "1000"})
+    public int depth;
+
+    private static int recurse(int depth) {
+        if (depth == 0) {
+            for (int i = 0; i < YIELDS; i++) {
+                Thread.yield();
+            }
+            return 0;
+        }
+        return recurse(depth - 1) + 1;
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(YIELDS)
+    public int yieldAtDepth() throws InterruptedException {
+        int[] result = new int[1];
+        Thread thread = Thread.ofVirtual().start(() -> result[0] = recurse(depth));
+        thread.join();
+        return result[0];
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.java.lang.invoke;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the cost of the atomic VarHandle access modes on a single
+ * uncontended field. On weakly ordered platforms the acquire, release and
+ * plain variants may be cheaper than the volatile ones, depending on the
+ * barriers C2 emits around the LoadStore nodes.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class VarHandleAtomicModes {
+
+    static final VarHandle VALUE;
+
+    static {
+        try {
+            VALUE = MethodHandles.lookup().findVarHandle(VarHandleAtomicModes.class, "value", long.class);
+        } catch (ReflectiveOperationException e) {
+            throw new ExceptionInInitializerError(e);
+        }
+    }
+
+    long value;
+
+    @Benchmark
+    public long compareAndExchange() {
+        long v = value;
+        return (long) VALUE.compareAndExchange(this, v, v + 1);
+    }
+
+    @Benchmark
+    public long compareAndExchangeAcquire() {
+        long v = value;
+        return (long) VALUE.compareAndExchangeAcquire(this, v, v + 1);
+    }
+
+    @Benchmark
+    public long compareAndExchangeRelease() {
+        long v = value;
+        return (long) VALUE.compareAndExchangeRelease(this, v, v + 1);
+    }
+
+    @Benchmark
+    public boolean compareAndSet() {
+        long v = value;
+        return VALUE.compareAndSet(this, v, v + 1);
+    }
+
+    @Benchmark
+    public boolean weakCompareAndSetPlain() {
+        long v = value;
+        return VALUE.weakCompareAndSetPlain(this, v, v + 1);
+    }
+
+    @Benchmark
+    public boolean weakCompareAndSetAcquire() {
+        long v = value;
+        return VALUE.weakCompareAndSetAcquire(this, v, v + 1);
+    }
+
+    @Benchmark
+    public boolean weakCompareAndSetRelease() {
+        long v = value;
+        return VALUE.weakCompareAndSetRelease(this, v, v + 1);
+    }
+
+    @Benchmark
+    public long getAndAdd() {
+        return (long) VALUE.getAndAdd(this, 1L);
+    }
+
+    @Benchmark
+    public long getAndAddAcquire() {
+        return (long) VALUE.getAndAddAcquire(this, 1L);
+    }
+
+    @Benchmark
+    public long getAndAddRelease() {
+        return (long) VALUE.getAndAddRelease(this, 1L);
+    }
+
+    @Benchmark
+    public long getAndSet() {
+        return (long) VALUE.getAndSet(this, 0L);
+    }
+}
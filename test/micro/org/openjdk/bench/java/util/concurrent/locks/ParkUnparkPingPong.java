@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.java.util.concurrent.locks;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Measures the round-trip latency of a park/unpark hand-off between the
+ * benchmark thread and a partner thread. Each operation unparks the
+ * partner and parks until the partner unparks it back, so the result is
+ * the cost of two Parker::unpark and two Parker::park calls.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class ParkUnparkPingPong {
+
+    volatile Thread benchThread;
+    volatile boolean running;
+    volatile int turn;
+    Thread partner;
+
+    @Setup
+    public void setup() {
+        running = true;
+        partner = new Thread(() -> {
+            while (running) {
+                if (turn == 1) {
+                    turn = 0;
+                    LockSupport.unpark(benchThread);
+                } else {
+                    LockSupport.park(this);
+                }
+            }
+        });
+        partner.setDaemon(true);
+        partner.start();
+    }
+
+    @TearDown
+    public void tearDown() throws InterruptedException {
+        running = false;
+        LockSupport.unpark(partner);
+        partner.join();
+    }
+
+    @Benchmark
+    public void pingPong() {
+        benchThread = Thread.currentThread();
+        turn = 1;
+        LockSupport.unpark(partner);
+        while (turn == 1) {
+            LockSupport.park(this);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.ArrayList;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the duration of G1 full collections of a fragmented heap, with
+ * and without balanced compaction.
+ *
+ * Every iteration garbage collects a share of the small objects and
+ * allocates new ones, so that every full collection has to compact most
+ * regions. Humongous arrays are interleaved with the small objects to skew
+ * the amount of work in the compaction queues of the workers. Run with
+ * different values of -XX:ParallelGCThreads to measure scalability.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 3)
+@Measurement(iterations = 10)
+public class G1FullGCCompaction {
+
+    @Param({"2000000"})
+    public int objects;
+
+    // Every humongousInterval:th allocation is a humongous array.
+    @Param({"20000"})
+    public int humongousInterval;
+
+    private ArrayList<Object> live;
+
+    private int round;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        live = new ArrayList<>(objects);
+        for (int i = 0; i < objects; i++) {
+            live.add(allocate(i));
+        }
+    }
+
+    @Setup(Level.Invocation)
+    public void fragment() {
+        // Replace every third object, leaving holes all over the heap.
+        round++;
+        for (int i = round % 3; i < objects; i += 3) {
+            live.set(i, allocate(i));
+        }
+    }
+
+    private Object allocate(int i) {
+        if (i % humongousInterval == 0) {
+            return new long[1024 * 1024];
+        }
+        return new byte[64 + (i % 7) * 32];
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC", "-Xms4g", "-Xmx4g", "-XX:+UnlockExperimentalVMOptions", "-XX:-G1FullGCBalancedCompaction" })
+    public void fullGC() {
+        System.gc();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC", "-Xms4g", "-Xmx4g", "-XX:+UnlockExperimentalVMOptions", "-XX:+G1FullGCBalancedCompaction" })
+    public void fullGCBalanced() {
+        System.gc();
+    }
+}
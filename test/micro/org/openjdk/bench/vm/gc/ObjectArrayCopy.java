@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Compares System.arraycopy of Object[] with that of long[] of the same
+ * length, to show the cost of the GC barriers in the oop arraycopy stubs.
+ * The copies into an old array exercise the G1 card dirtying path, and the
+ * checkcast variant goes through the element type-checking stub.
+ *
+ * Run with each collector, e.g. -XX:+UseG1GC, -XX:+UseZGC and
+ * -XX:+UseParallelGC.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgsAppend = { "-Xms1g", "-Xmx1g" })
+public class ObjectArrayCopy {
+
+    @Param({"16", "256", "4096", "65536"})
+    public int size;
+
+    Object[] objSrc;
+    Object[] objDst;
+    String[] strDst;
+    long[] longSrc;
+    long[] longDst;
+
+    @Setup
+    public void setup() {
+        objDst = new Object[size];
+        strDst = new String[size];
+        longSrc = new long[size];
+        longDst = new long[size];
+        // Promote the destination arrays so stores into them are old-to-young.
+        System.gc();
+        // The sources are allocated after the gc so that they stay young;
+        // the benchmarks do not allocate, so no gc promotes them later.
+        objSrc = new Object[size];
+        for (int i = 0; i < size; i++) {
+            objSrc[i] = Integer.toString(i);
+        }
+    }
+
+    @Benchmark
+    public Object[] copyObject() {
+        System.arraycopy(objSrc, 0, objDst, 0, size);
+        return objDst;
+    }
+
+    @Benchmark
+    public Object[] copyObjectCheckCast() {
+        System.arraycopy(objSrc, 0, strDst, 0, size);
+        return strDst;
+    }
+
+    @Benchmark
+    public Object[] copyObjectOverlapping() {
+        System.arraycopy(objSrc, 0, objSrc, 1, size - 1);
+        return objSrc;
+    }
+
+    @Benchmark
+    public long[] copyLong() {
+        System.arraycopy(longSrc, 0, longDst, 0, size);
+        return longDst;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the pause time of System.gc() as a function of the size of the
+ * live set, which is a linked structure of small objects so that marking
+ * and compaction dominate.
+ *
+ * Run with -XX:+UseParallelGC, -XX:+UseSerialGC etc. to compare collectors.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 3)
+@Measurement(iterations = 10)
+@Fork(value = 3, jvmArgsAppend = { "-Xms4g", "-Xmx4g" })
+public class PauseVsLiveSet {
+
+    // Live set in MB, approximately.
+    @Param({"64", "256", "1024"})
+    public int liveMB;
+
+    static final class Node {
+        Node next;
+        Object payload;
+        Node(Node next) {
+            this.next = next;
+            this.payload = new int[2];
+        }
+    }
+
+    private Node head;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        // A Node with its payload is roughly 48 bytes.
+        long count = (long) liveMB * 1024 * 1024 / 48;
+        Node n = null;
+        for (long i = 0; i < count; i++) {
+            n = new Node(n);
+        }
+        head = n;
+    }
+
+    @Benchmark
+    public void systemGC() {
+        System.gc();
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the duration of a full collection that has to discover and
+ * process a large number of references whose referents are unreachable.
+ *
+ * Half of the references are registered with a queue, so that enqueuing
+ * is part of the measured work as well. After every invocation the
+ * benchmark checks that all referents were cleared and that the queue
+ * received all registered references.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 3)
+@Measurement(iterations = 10)
+@Fork(value = 3, jvmArgsAppend = { "-Xms2g", "-Xmx2g" })
+public class ReferenceProcessing {
+
+    @Param({"100000", "1000000"})
+    public int references;
+
+    private final ReferenceQueue<Object> queue = new ReferenceQueue<>();
+
+    private ArrayList<Reference<Object>> refs;
+
+    private void createReferences(boolean soft) {
+        refs = new ArrayList<>(references);
+        for (int i = 0; i < references; i++) {
+            ReferenceQueue<Object> q = (i & 1) == 0 ? queue : null;
+            refs.add(soft ? new SoftReference<>(new Object(), q)
+                          : new WeakReference<>(new Object(), q));
+        }
+    }
+
+    private void verifyCleared() throws InterruptedException {
+        for (Reference<Object> ref : refs) {
+            if (!ref.refersTo(null)) {
+                throw new IllegalStateException("Reference was not cleared");
+            }
+        }
+        // Enqueuing is done by the reference handler thread, so wait for it.
+        for (int i = 0; i < (references + 1) / 2; i++) {
+            if (queue.remove(10_000) == null) {
+                throw new IllegalStateException("Only " + i + " references were enqueued");
+            }
+        }
+        if (queue.poll() != null) {
+            throw new IllegalStateException("Too many references were enqueued");
+        }
+        refs = null;
+    }
+
+    @State(Scope.Benchmark)
+    public static class WeakReferences {
+        @Setup(Level.Invocation)
+        public void setup(ReferenceProcessing bench) {
+            bench.createReferences(false);
+        }
+
+        @TearDown(Level.Invocation)
+        public void teardown(ReferenceProcessing bench) throws InterruptedException {
+            bench.verifyCleared();
+        }
+    }
+
+    @State(Scope.Benchmark)
+    public static class SoftReferences {
+        @Setup(Level.Invocation)
+        public void setup(ReferenceProcessing bench) throws InterruptedException {
+            bench.createReferences(true);
+            // A new SoftReference gets the current SoftReference.clock as its
+            // timestamp, and the LRU policies never clear a reference whose
+            // timestamp equals the clock, not even with a zero
+            // SoftRefLRUPolicyMSPerMB. Let a collection move the clock past
+            // the timestamps. This one keeps the referents alive.
+            Thread.sleep(2);
+            System.gc();
+        }
+
+        @TearDown(Level.Invocation)
+        public void teardown(ReferenceProcessing bench) throws InterruptedException {
+            bench.verifyCleared();
+        }
+    }
+
+    @Benchmark
+    public void weak(WeakReferences refs) {
+        System.gc();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-Xms2g", "-Xmx2g", "-XX:SoftRefLRUPolicyMSPerMB=0" })
+    public void soft(SoftReferences refs) {
+        // The clock has moved past the timestamps of the soft references, so
+        // with a zero LRU policy they are cleared like weak references.
+        System.gc();
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OperationsPerInvocation;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the cost of reference stores, including the write barrier of
+ * each collector.
+ *
+ * The target array is promoted to the old generation during setup, so that
+ * storing young objects into it takes the generational (cross-region or
+ * card marking) slow path where the collector has one. Storing null and
+ * storing old objects measure the filtered fast paths.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+public class WriteBarrier {
+
+    private static final int SIZE = 1024;
+
+    private Object[] target;
+    private Object[] oldValues;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        target = new Object[SIZE];
+        oldValues = new Object[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            oldValues[i] = new Object();
+        }
+        // Promote target and oldValues.
+        for (int i = 0; i < 3; i++) {
+            System.gc();
+        }
+    }
+
+    private void storeYoung() {
+        Object[] t = target;
+        for (int i = 0; i < SIZE; i++) {
+            t[i] = new Object();
+        }
+    }
+
+    private void storeOld() {
+        Object[] t = target;
+        Object[] v = oldValues;
+        for (int i = 0; i < SIZE; i++) {
+            t[i] = v[i];
+        }
+    }
+
+    private void storeNull() {
+        Object[] t = target;
+        for (int i = 0; i < SIZE; i++) {
+            t[i] = null;
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(SIZE)
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseSerialGC" })
+    public void serialYoung() {
+        storeYoung();
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(SIZE)
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseParallelGC" })
+    public void parallelYoung() {
+        storeYoung();
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(SIZE)
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC" })
+    public void g1Young() {
+        storeYoung();
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(SIZE)
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC" })
+    public void g1Old() {
+        storeOld();
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(SIZE)
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseG1GC" })
+    public void g1Null() {
+        storeNull();
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(SIZE)
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseZGC", "-XX:+ZGenerational" })
+    public void zYoung() {
+        storeYoung();
+    }
+}
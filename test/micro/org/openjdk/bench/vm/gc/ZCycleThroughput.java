@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.AuxCounters;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.HashMap;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the throughput of whole ZGC cycles on a large, pointer-heavy
+ * heap, with and without prefetching of objects popped from the mark stack.
+ *
+ * Each invocation runs a complete System.gc() cycle, and the reported
+ * "liveMB" rate is the live heap processed per second of cycle time. The
+ * heap is almost entirely live and nothing is left to relocate after the
+ * first cycle, so marking dominates the cycle, but the rate also includes
+ * the pauses, reference processing and relocation set selection. It is a
+ * lower bound for the mark throughput of the single concurrent GC thread.
+ * For the mark phase alone, compare the "Concurrent Mark" times reported
+ * with -Xlog:gc+phases=debug.
+ */
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 3, time = 5, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 10, timeUnit = TimeUnit.SECONDS)
+public class ZCycleThroughput {
+
+    @Param({"4000000"})
+    public int entries;
+
+    // Keeps the object graph alive
+    private HashMap<Long, Long> map;
+
+    private long liveBytes;
+
+    @State(Scope.Thread)
+    @AuxCounters(AuxCounters.Type.EVENTS)
+    public static class Counters {
+        public double liveMB;
+    }
+
+    @Setup(Level.Trial)
+    public void setup() {
+        map = new HashMap<>();
+        for (long i = 0; i < entries; i++) {
+            // Spread keys so that nodes of the same bucket chain are
+            // allocated far apart
+            map.put(i * 0x9E3779B97F4A7C15L, i);
+        }
+
+        System.gc();
+        final Runtime runtime = Runtime.getRuntime();
+        liveBytes = runtime.totalMemory() - runtime.freeMemory();
+    }
+
+    private void collect(Counters counters) {
+        System.gc();
+        counters.liveMB += (double)liveBytes / (1024 * 1024);
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseZGC", "-Xms4g", "-Xmx4g", "-XX:ConcGCThreads=1", "-XX:-ZMarkPrefetch" })
+    public void noPrefetch(Counters counters) {
+        collect(counters);
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UseZGC", "-Xms4g", "-Xmx4g", "-XX:ConcGCThreads=1", "-XX:+ZMarkPrefetch" })
+    public void prefetch(Counters counters) {
+        collect(counters);
+    }
+}
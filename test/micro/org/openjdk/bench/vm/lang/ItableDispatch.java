@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures megamorphic interface call cost as a function of the position
+ * of the target interface in the receiver's itable. The itable stubs scan
+ * the itable offset table linearly, so calls through interfaces near the
+ * end of a long implements list are slower.
+ *
+ * Four receiver classes are used so the call site goes megamorphic and is
+ * dispatched through an itable stub rather than inlined. Each class
+ * implements the interfaces directly and has its own implementation of
+ * the measured methods, and the receivers are typed as Object, so class
+ * hierarchy analysis cannot devirtualize the calls either. The other
+ * interfaces only provide default methods, which still take a slot in
+ * the itable.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class ItableDispatch {
+
+    interface I01 { int m01(); }
+    interface I02 { default int m02() { return 2; } }
+    interface I03 { default int m03() { return 3; } }
+    interface I04 { default int m04() { return 4; } }
+    interface I05 { default int m05() { return 5; } }
+    interface I06 { default int m06() { return 6; } }
+    interface I07 { default int m07() { return 7; } }
+    interface I08 { int m08(); }
+    interface I09 { default int m09() { return 9; } }
+    interface I10 { default int m10() { return 10; } }
+    interface I11 { default int m11() { return 11; } }
+    interface I12 { default int m12() { return 12; } }
+    interface I13 { default int m13() { return 13; } }
+    interface I14 { default int m14() { return 14; } }
+    interface I15 { default int m15() { return 15; } }
+    interface I16 { int m16(); }
+    interface I17 { default int m17() { return 17; } }
+    interface I18 { default int m18() { return 18; } }
+    interface I19 { default int m19() { return 19; } }
+    interface I20 { default int m20() { return 20; } }
+    interface I21 { default int m21() { return 21; } }
+    interface I22 { default int m22() { return 22; } }
+    interface I23 { default int m23() { return 23; } }
+    interface I24 { default int m24() { return 24; } }
+    interface I25 { default int m25() { return 25; } }
+    interface I26 { default int m26() { return 26; } }
+    interface I27 { default int m27() { return 27; } }
+    interface I28 { default int m28() { return 28; } }
+    interface I29 { default int m29() { return 29; } }
+    interface I30 { default int m30() { return 30; } }
+    interface I31 { default int m31() { return 31; } }
+    interface I32 { int m32(); }
+
+    static class A implements
+            I01, I02, I03, I04, I05, I06, I07, I08, I09, I10, I11,
+            I12, I13, I14, I15, I16, I17, I18, I19, I20, I21, I22,
+            I23, I24, I25, I26, I27, I28, I29, I30, I31, I32 {
+        public int m01() { return 1; }  public int m08() { return 8; }
+        public int m16() { return 16; } public int m32() { return 32; }
+    }
+
+    static class B implements
+            I01, I02, I03, I04, I05, I06, I07, I08, I09, I10, I11,
+            I12, I13, I14, I15, I16, I17, I18, I19, I20, I21, I22,
+            I23, I24, I25, I26, I27, I28, I29, I30, I31, I32 {
+        public int m01() { return 101; } public int m08() { return 108; }
+        public int m16() { return 116; } public int m32() { return 132; }
+    }
+
+    static class C implements
+            I01, I02, I03, I04, I05, I06, I07, I08, I09, I10, I11,
+            I12, I13, I14, I15, I16, I17, I18, I19, I20, I21, I22,
+            I23, I24, I25, I26, I27, I28, I29, I30, I31, I32 {
+        public int m01() { return 201; } public int m08() { return 208; }
+        public int m16() { return 216; } public int m32() { return 232; }
+    }
+
+    static class D implements
+            I01, I02, I03, I04, I05, I06, I07, I08, I09, I10, I11,
+            I12, I13, I14, I15, I16, I17, I18, I19, I20, I21, I22,
+            I23, I24, I25, I26, I27, I28, I29, I30, I31, I32 {
+        public int m01() { return 301; } public int m08() { return 308; }
+        public int m16() { return 316; } public int m32() { return 332; }
+    }
+
+    // Position of the called interface in the implements list.
+    @Param({"1", "8", "16", "32"})
+    public int position;
+
+    Object[] receivers;
+
+    @Setup
+    public void setup() {
+        receivers = new Object[] { new A(), new B(), new C(), new D() };
+    }
+
+    @Benchmark
+    public int call() {
+        int sum = 0;
+        for (Object r : receivers) {
+            sum += switch (position) {
+                case 1  -> ((I01) r).m01();
+                case 8  -> ((I08) r).m08();
+                case 16 -> ((I16) r).m16();
+                default -> ((I32) r).m32();
+            };
+        }
+        return sum;
+    }
+}
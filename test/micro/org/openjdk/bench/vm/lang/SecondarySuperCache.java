@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Threads;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures instanceof checks against interfaces, which go through the
+ * secondary supers of the receiver class. The alternating variants check
+ * the same receiver against two interfaces in turn, which defeats the
+ * one-element secondary super cache when the linear scan is used and,
+ * with several threads, makes the cache line ping-pong between cores.
+ *
+ * Each check sees RECEIVERS different receiver classes, more than
+ * TypeProfileWidth, so C2 cannot fold the check into an exact klass
+ * compare from the type profile and really performs the lookup.
+ *
+ * Compare -XX:+UnlockDiagnosticVMOptions -XX:-UseSecondarySupersTable
+ * against the default to see the effect of the hashed lookup.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class SecondarySuperCache {
+
+    interface I01 {} interface I02 {} interface I03 {} interface I04 {}
+    interface I05 {} interface I06 {} interface I07 {} interface I08 {}
+    interface I09 {} interface I10 {} interface I11 {} interface I12 {}
+    interface I13 {} interface I14 {} interface I15 {} interface I16 {}
+
+    static class Small0 implements I01, I02 {}
+    static class Small1 implements I01, I02 {}
+    static class Small2 implements I01, I02 {}
+    static class Small3 implements I01, I02 {}
+
+    static class Large0 implements I01, I02, I03, I04, I05, I06, I07, I08,
+                                   I09, I10, I11, I12, I13, I14, I15, I16 {}
+    static class Large1 implements I01, I02, I03, I04, I05, I06, I07, I08,
+                                   I09, I10, I11, I12, I13, I14, I15, I16 {}
+    static class Large2 implements I01, I02, I03, I04, I05, I06, I07, I08,
+                                   I09, I10, I11, I12, I13, I14, I15, I16 {}
+    static class Large3 implements I01, I02, I03, I04, I05, I06, I07, I08,
+                                   I09, I10, I11, I12, I13, I14, I15, I16 {}
+
+    static final int RECEIVERS = 4;
+
+    Object[] small = { new Small0(), new Small1(), new Small2(), new Small3() };
+    Object[] large = { new Large0(), new Large1(), new Large2(), new Large3() };
+
+    int index;
+
+    Object next(Object[] receivers) {
+        return receivers[index++ & (RECEIVERS - 1)];
+    }
+
+    @Benchmark
+    public boolean smallSingle() {
+        return next(small) instanceof I02;
+    }
+
+    @Benchmark
+    public boolean largeSingle() {
+        return next(large) instanceof I16;
+    }
+
+    @Benchmark
+    public boolean smallAlternating() {
+        Object o = next(small);
+        return (o instanceof I01) & (o instanceof I02);
+    }
+
+    @Benchmark
+    public boolean largeAlternating() {
+        Object o = next(large);
+        return (o instanceof I01) & (o instanceof I16);
+    }
+
+    @Benchmark
+    public boolean largeMiss() {
+        return next(small) instanceof I16;
+    }
+
+    @Benchmark
+    @Threads(4)
+    public boolean largeAlternatingContended() {
+        Object o = next(large);
+        return (o instanceof I08) & (o instanceof I16);
+    }
+}